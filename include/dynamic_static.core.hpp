@@ -12,21 +12,36 @@
 
 #include "dynamic_static/core/action.hpp"
 #include "dynamic_static/core/algorithm.hpp"
+#include "dynamic_static/core/cancellation-token.hpp"
+#include "dynamic_static/core/concurrent-delegate.hpp"
+#include "dynamic_static/core/concurrent-event.hpp"
 #include "dynamic_static/core/defines.hpp"
+#include "dynamic_static/core/delegate-base.hpp"
+#include "dynamic_static/core/delegate-parallel.hpp"
 #include "dynamic_static/core/delegate.hpp"
 #include "dynamic_static/core/enum.hpp"
+#include "dynamic_static/core/event-profiler.hpp"
 #include "dynamic_static/core/event.hpp"
 #include "dynamic_static/core/file.hpp"
+#include "dynamic_static/core/inline-function.hpp"
 #include "dynamic_static/core/math.hpp"
 #include "dynamic_static/core/memory.hpp"
+#include "dynamic_static/core/mpmc-queue.hpp"
+#include "dynamic_static/core/parallel.hpp"
 #include "dynamic_static/core/random.hpp"
+#include "dynamic_static/core/signal.hpp"
 #include "dynamic_static/core/span.hpp"
+#include "dynamic_static/core/spsc-queue.hpp"
 #include "dynamic_static/core/stream-guard.hpp"
 #include "dynamic_static/core/string.hpp"
 #include "dynamic_static/core/subscribable.hpp"
 #include "dynamic_static/core/tab.hpp"
+#include "dynamic_static/core/task-graph.hpp"
+#include "dynamic_static/core/task-group.hpp"
+#include "dynamic_static/core/task.hpp"
 #include "dynamic_static/core/thread-pool.hpp"
 #include "dynamic_static/core/time.hpp"
+#include "dynamic_static/core/timer-wheel.hpp"
 #include "dynamic_static/core/transform.hpp"
 #include "dynamic_static/core/version.hpp"
 #include "dynamic_static/core/win32-lean-and-mean.hpp"
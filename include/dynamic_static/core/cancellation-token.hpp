@@ -0,0 +1,107 @@
+/*
+==========================================
+  Copyright (c) 2020 Dynamic_Static
+    Patrick Purcell
+      Licensed under the MIT license
+    http://opensource.org/licenses/MIT
+==========================================
+*/
+
+#pragma once
+
+#include "dynamic_static/core/defines.hpp"
+
+#include <atomic>
+#include <memory>
+
+namespace dst {
+
+/**
+Observes whether or not cancellation has been requested by a CancellationSource
+    @note CancellationToken objects are cheap to copy, all copies observe the same CancellationSource
+    @note A default constructed CancellationToken is never cancelled
+*/
+class CancellationToken final
+{
+public:
+    /**
+    Constructs an instance of CancellationToken
+    */
+    CancellationToken() = default;
+
+    /**
+    Gets a value indicating whether or not this CancellationToken is associated with a CancellationSource
+    @return Whether or not this CancellationToken is associated with a CancellationSource
+    */
+    inline bool can_be_cancelled() const
+    {
+        return (bool)mspCancelled;
+    }
+
+    /**
+    Gets a value indicating whether or not cancellation has been requested
+    @return Whether or not cancellation has been requested
+    */
+    inline bool is_cancelled() const
+    {
+        return mspCancelled && mspCancelled->load(std::memory_order_acquire);
+    }
+
+private:
+    inline explicit CancellationToken(std::shared_ptr<const std::atomic_bool> spCancelled)
+        : mspCancelled { std::move(spCancelled) }
+    {
+    }
+
+    std::shared_ptr<const std::atomic_bool> mspCancelled;
+    friend class CancellationSource;
+};
+
+/**
+Requests cancellation of work associated with its CancellationToken objects
+    @note Cancellation is cooperative, work checks CancellationToken::is_cancelled() and stops on its own
+    @note CancellationSource objects are cheap to copy, all copies share the same cancellation state
+*/
+class CancellationSource final
+{
+public:
+    /**
+    Constructs an instance of CancellationSource
+    */
+    inline CancellationSource()
+        : mspCancelled { std::make_shared<std::atomic_bool>(false) }
+    {
+    }
+
+    /**
+    Gets a CancellationToken associated with this CancellationSource
+    @return A CancellationToken associated with this CancellationSource
+    */
+    inline CancellationToken get_token() const
+    {
+        return CancellationToken(mspCancelled);
+    }
+
+    /**
+    Requests cancellation of work associated with this CancellationSource object's CancellationToken objects
+        @note Cancellation can't be undone, use a new CancellationSource for new work
+    */
+    inline void cancel()
+    {
+        mspCancelled->store(true, std::memory_order_release);
+    }
+
+    /**
+    Gets a value indicating whether or not cancellation has been requested
+    @return Whether or not cancellation has been requested
+    */
+    inline bool is_cancelled() const
+    {
+        return mspCancelled->load(std::memory_order_acquire);
+    }
+
+private:
+    std::shared_ptr<std::atomic_bool> mspCancelled;
+};
+
+} // namespace dst
@@ -0,0 +1,301 @@
+/*
+==========================================
+  Copyright (c) 2020 Dynamic_Static
+    Patrick Purcell
+      Licensed under the MIT license
+    http://opensource.org/licenses/MIT
+==========================================
+*/
+
+#pragma once
+
+#include "dynamic_static/core/action.hpp"
+#include "dynamic_static/core/defines.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace dst {
+namespace detail {
+
+/**
+Records the ConcurrentDelegate<> objects that are being called on the calling thread
+*/
+struct ConcurrentDispatchScope final
+{
+    /**
+    Gets the innermost ConcurrentDispatchScope of the calling thread
+    @return A reference to the innermost ConcurrentDispatchScope of the calling thread
+    */
+    static inline const ConcurrentDispatchScope*& get_current()
+    {
+        thread_local const ConcurrentDispatchScope* tlpCurrent { nullptr };
+        return tlpCurrent;
+    }
+
+    const void* pDelegate { nullptr };
+    const ConcurrentDispatchScope* pPrevious { nullptr };
+};
+
+} // namespace detail
+
+/**
+Multicast Action<> that can be called, subscribed to, and unsubscribed from on any thread
+@param <...Args> The argument types of this ConcurrentDelegate<> object's subscribers
+    @note Calling a ConcurrentDelegate<> is lock free, subscribers are read from an immutable list that's replaced (copy on write) when subscribers are added or removed
+    @note Subscribing and unsubscribing are serialized by a mutex, replaced lists are freed once no thread can be reading them
+    @note Unlike Delegate<>, subscribers are Action<> objects identified by SubscriptionId rather than Subscribable links, so a subscriber's lifetime isn't tied to this ConcurrentDelegate<>
+*/
+template <typename ...Args>
+class ConcurrentDelegate
+{
+public:
+    /**
+    Identifies a subscriber of a ConcurrentDelegate<>
+    */
+    using SubscriptionId = uint64_t;
+
+    /**
+    The SubscriptionId that doesn't identify any subscriber
+    */
+    static constexpr SubscriptionId InvalidSubscriptionId { 0 };
+
+    /**
+    Constructs an instance of ConcurrentDelegate<>
+    */
+    ConcurrentDelegate() = default;
+
+    /**
+    Destroys this instance of ConcurrentDelegate<>
+        @note This ConcurrentDelegate<> must not be called, subscribed to, or unsubscribed from during the scope of this method
+    */
+    inline ~ConcurrentDelegate()
+    {
+        delete mpSubscribers.load(std::memory_order_relaxed);
+    }
+
+    /**
+    Adds a subscriber to this ConcurrentDelegate<>
+    @param <ActionType> The type of the subscriber
+    @param [in] action The subscriber
+    @return The SubscriptionId of the subscriber, or InvalidSubscriptionId if action is empty
+        @note ActionType must have a signautre compatible with this ConcurrentDelegate<> object's <...Args> parameter
+        @note Calls to this ConcurrentDelegate<> that begin after this method returns will call the subscriber
+        @note Subscribers are called in the order they were subscribed in
+    */
+    template <typename ActionType>
+    inline SubscriptionId subscribe(ActionType action)
+    {
+        auto spAction = std::make_shared<const Action<Args...>>(std::move(action));
+        if (!*spAction) {
+            return InvalidSubscriptionId;
+        }
+        SubscriptionId id = InvalidSubscriptionId;
+        update(
+            [&](Subscribers& subscribers)
+            {
+                id = ++mSubscriptionIdCounter;
+                subscribers.push_back({ id, std::move(spAction) });
+                return true;
+            }
+        );
+        return id;
+    }
+
+    /**
+    Removes a subscriber from this ConcurrentDelegate<>
+    @param [in] id The SubscriptionId of the subscriber to remove
+    @return Whether or not the subscriber was removed
+        @note When this method returns the subscriber isn't being called on any thread, so resources it references can be released
+        @note When called from within a call to this ConcurrentDelegate<> on the calling thread, calls already in progress on other threads may still be calling the subscriber when this method returns
+    */
+    inline bool unsubscribe(SubscriptionId id)
+    {
+        return update(
+            [&](Subscribers& subscribers)
+            {
+                for (auto itr = subscribers.begin(); itr != subscribers.end(); ++itr) {
+                    if (itr->first == id) {
+                        subscribers.erase(itr);
+                        return true;
+                    }
+                }
+                return false;
+            }
+        );
+    }
+
+    /**
+    Gets the number of subscribers of this ConcurrentDelegate<>
+    @return The number of subscribers of this ConcurrentDelegate<>
+        @note The value returned by this method may be stale by the time it's read
+    */
+    inline size_t get_subscriber_count() const
+    {
+        ReadGuard readGuard(*this);
+        return readGuard.pSubscribers ? readGuard.pSubscribers->size() : 0;
+    }
+
+    /**
+    Calls this ConcurrentDelegate<> object's subscribers with the given arguments
+    @param [in] args The arguments to call this ConcurrentDelegate<> object's subscribers with
+        @note Subscribers are called in the order they were subscribed in
+        @note Subscribers added or removed during the scope of this method, on any thread, don't affect which subscribers this call calls
+        @note Subscribers may subscribe to, unsubscribe from, and call this ConcurrentDelegate<>
+    */
+    inline void operator()(Args... args) const
+    {
+        ReadGuard readGuard(*this);
+        if (readGuard.pSubscribers) {
+            auto& pCurrentScope = detail::ConcurrentDispatchScope::get_current();
+            ScopeGuard scopeGuard(pCurrentScope, this);
+            for (const auto& subscriber : *readGuard.pSubscribers) {
+                (*subscriber.second)(args...);
+            }
+        }
+    }
+
+    /**
+    Removes all subscribers from this ConcurrentDelegate<>
+        @note When this method returns the removed subscribers aren't being called on any thread, unless this method is called from within a call to this ConcurrentDelegate<>
+    */
+    inline void clear()
+    {
+        update(
+            [](Subscribers& subscribers)
+            {
+                auto cleared = !subscribers.empty();
+                subscribers.clear();
+                return cleared;
+            }
+        );
+    }
+
+private:
+    using Subscriber = std::pair<SubscriptionId, std::shared_ptr<const Action<Args...>>>;
+    using Subscribers = std::vector<Subscriber>;
+
+    class ReadGuard final
+    {
+    public:
+        inline ReadGuard(const ConcurrentDelegate<Args...>& delegate)
+            : mReaderCount { delegate.mReaderCounts[delegate.mEpoch.load() & 1] }
+        {
+            // NOTE : The reader count must be incremented before the subscriber list is
+            //  loaded, update() waits for the count to drain before freeing a list.
+            mReaderCount.fetch_add(1);
+            pSubscribers = delegate.mpSubscribers.load();
+        }
+
+        inline ~ReadGuard()
+        {
+            mReaderCount.fetch_sub(1, std::memory_order_release);
+        }
+
+        const Subscribers* pSubscribers { nullptr };
+
+    private:
+        std::atomic_size_t& mReaderCount;
+        ReadGuard(const ReadGuard&) = delete;
+        ReadGuard& operator=(const ReadGuard&) = delete;
+    };
+
+    class ScopeGuard final
+    {
+    public:
+        inline ScopeGuard(const detail::ConcurrentDispatchScope*& pCurrentScope, const void* pDelegate)
+            : mpCurrentScope { pCurrentScope }
+            , mScope { pDelegate, pCurrentScope }
+        {
+            mpCurrentScope = &mScope;
+        }
+
+        inline ~ScopeGuard()
+        {
+            mpCurrentScope = mScope.pPrevious;
+        }
+
+    private:
+        const detail::ConcurrentDispatchScope*& mpCurrentScope;
+        detail::ConcurrentDispatchScope mScope;
+        ScopeGuard(const ScopeGuard&) = delete;
+        ScopeGuard& operator=(const ScopeGuard&) = delete;
+    };
+
+    template <typename UpdateFunctionType>
+    inline bool update(UpdateFunctionType updateFunction)
+    {
+        std::vector<std::unique_ptr<const Subscribers>> retiredSubscribers;
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            auto pSubscribers = mpSubscribers.load(std::memory_order_relaxed);
+            auto upSubscribers = pSubscribers ? std::make_unique<Subscribers>(*pSubscribers) : std::make_unique<Subscribers>();
+            if (!updateFunction(*upSubscribers)) {
+                return false;
+            }
+            if (upSubscribers->empty()) {
+                upSubscribers.reset();
+            }
+            mRetiredSubscribers.emplace_back(mpSubscribers.exchange(upSubscribers.release()));
+            if (!is_dispatching()) {
+                retiredSubscribers = std::move(mRetiredSubscribers);
+                mRetiredSubscribers.clear();
+            }
+        }
+        if (!retiredSubscribers.empty()) {
+            // NOTE : Every retired list was replaced before synchronize() so once it
+            //  returns no reader can still be holding one.  Retired lists are kept
+            //  when this thread is calling this ConcurrentDelegate<> because waiting
+            //  for readers would wait on this thread's own read.  mMutex isn't held
+            //  while waiting because the readers being waited on may be subscribers
+            //  that subscribe to or unsubscribe from this ConcurrentDelegate<>.
+            synchronize();
+        }
+        return true;
+    }
+
+    inline bool is_dispatching() const
+    {
+        for (auto pScope = detail::ConcurrentDispatchScope::get_current(); pScope; pScope = pScope->pPrevious) {
+            if (pScope->pDelegate == this) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    inline void synchronize()
+    {
+        std::lock_guard<std::mutex> lock(mSynchronizeMutex);
+        // NOTE : Readers increment the count selected by mEpoch before loading the
+        //  list.  A reader holding a replaced list may have read either epoch, so
+        //  the epoch is flipped twice and each count drains in turn, readers that
+        //  start after a flip use the other count and don't delay the wait.
+        //  mSynchronizeMutex keeps flips from concurrent updates from interleaving,
+        //  interleaved flips could skip one of the counts.
+        for (int i = 0; i < 2; ++i) {
+            auto epoch = mEpoch.load(std::memory_order_relaxed);
+            mEpoch.store(epoch + 1);
+            while (mReaderCounts[epoch & 1].load()) {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    std::atomic<const Subscribers*> mpSubscribers { nullptr };
+    std::atomic_size_t mEpoch { 0 };
+    mutable std::atomic_size_t mReaderCounts[2] { };
+    std::mutex mMutex;
+    std::mutex mSynchronizeMutex;
+    SubscriptionId mSubscriptionIdCounter { InvalidSubscriptionId };
+    std::vector<std::unique_ptr<const Subscribers>> mRetiredSubscribers;
+    ConcurrentDelegate(const ConcurrentDelegate&) = delete;
+    ConcurrentDelegate& operator=(const ConcurrentDelegate&) = delete;
+};
+
+} // namespace dst
@@ -0,0 +1,101 @@
+/*
+==========================================
+  Copyright (c) 2020 Dynamic_Static
+    Patrick Purcell
+      Licensed under the MIT license
+    http://opensource.org/licenses/MIT
+==========================================
+*/
+
+#pragma once
+
+#include "dynamic_static/core/concurrent-delegate.hpp"
+#include "dynamic_static/core/defines.hpp"
+
+#include <utility>
+
+namespace dst {
+
+/**
+Multicast Action<> that can be subscribed to on any thread and called on any thread by a specified type
+@param <CallerType> The type that can call this ConcurrentEvent<>
+@param <...Args> This ConcurrentEvent<> object's argument types
+    @note See ConcurrentDelegate<> for details about thread safety
+*/
+template <typename CallerType, typename ...Args>
+class ConcurrentEvent
+    : private ConcurrentDelegate<Args...>
+{
+    friend CallerType;
+
+public:
+    /**
+    Identifies a subscriber of a ConcurrentEvent<>
+    */
+    using SubscriptionId = typename ConcurrentDelegate<Args...>::SubscriptionId;
+
+    /**
+    The SubscriptionId that doesn't identify any subscriber
+    */
+    static constexpr SubscriptionId InvalidSubscriptionId { ConcurrentDelegate<Args...>::InvalidSubscriptionId };
+
+    /**
+    Adds a subscriber to this ConcurrentEvent<>
+    @param <ActionType> The type of the subscriber
+    @param [in] action The subscriber
+    @return The SubscriptionId of the subscriber, or InvalidSubscriptionId if action is empty
+        @note ActionType must have a signautre compatible with this ConcurrentEvent<> object's <...Args> parameter
+    */
+    template <typename ActionType>
+    inline SubscriptionId subscribe(ActionType action)
+    {
+        return ConcurrentDelegate<Args...>::subscribe(std::move(action));
+    }
+
+    /**
+    Removes a subscriber from this ConcurrentEvent<>
+    @param [in] id The SubscriptionId of the subscriber to remove
+    @return Whether or not the subscriber was removed
+        @note When this method returns the subscriber isn't being called on any thread, unless this method is called from within a call to this ConcurrentEvent<>
+    */
+    inline bool unsubscribe(SubscriptionId id)
+    {
+        return ConcurrentDelegate<Args...>::unsubscribe(id);
+    }
+
+    /**
+    Gets the number of subscribers of this ConcurrentEvent<>
+    @return The number of subscribers of this ConcurrentEvent<>
+        @note The value returned by this method may be stale by the time it's read
+    */
+    inline size_t get_subscriber_count() const
+    {
+        return ConcurrentDelegate<Args...>::get_subscriber_count();
+    }
+
+private:
+    /**
+    Constructs an instance of ConcurrentEvent<>
+    */
+    ConcurrentEvent() = default;
+
+    /**
+    Calls this ConcurrentEvent<> object's subscribers with the given arguments
+    @param [in] args The arguments to call this ConcurrentEvent<> object's subscribers with
+        @note Subscribers are called in the order they were subscribed in
+    */
+    inline void operator()(Args... args) const
+    {
+        ConcurrentDelegate<Args...>::operator()(args...);
+    }
+
+    /**
+    Removes all subscribers from this ConcurrentEvent<>
+    */
+    inline void clear()
+    {
+        ConcurrentDelegate<Args...>::clear();
+    }
+};
+
+} // namespace dst
@@ -47,6 +47,14 @@
 #endif
 #endif
 
+#if defined(__cpp_impl_coroutine) && defined(__has_include)
+#if __has_include(<coroutine>)
+#ifndef DYNAMIC_STATIC_COROUTINES_ENABLED
+#define DYNAMIC_STATIC_COROUTINES_ENABLED
+#endif
+#endif
+#endif
+
 #define DYNAMIC_STATIC_CORE_VERSION_MAJOR 2
 #define DYNAMIC_STATIC_CORE_VERSION_MINOR 0
 #define DYNAMIC_STATIC_CORE_VERSION_PATCH 0
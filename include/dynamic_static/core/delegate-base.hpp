@@ -0,0 +1,283 @@
+
+/*
+==========================================
+  Copyright (c) 2020 Dynamic_Static
+    Patrick Purcell
+      Licensed under the MIT license
+    http://opensource.org/licenses/MIT
+==========================================
+*/
+
+#pragma once
+
+#include "dynamic_static/core/defines.hpp"
+#include "dynamic_static/core/inline-function.hpp"
+#include "dynamic_static/core/subscribable.hpp"
+#ifdef DYNAMIC_STATIC_EVENT_PROFILING_ENABLED
+#include "dynamic_static/core/event-profiler.hpp"
+#endif
+
+#include <atomic>
+#include <cstdint>
+#include <type_traits>
+#ifdef DYNAMIC_STATIC_EVENT_PROFILING_ENABLED
+#include <typeinfo>
+#endif
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#ifndef DYNAMIC_STATIC_DELEGATE_CAPACITY
+#define DYNAMIC_STATIC_DELEGATE_CAPACITY (4 * sizeof(void*))
+#endif
+
+namespace dst {
+namespace detail {
+
+/**
+Provides the Action<> storage, subscriptions, and cached invocation lists shared by Delegate<> and Signal<>
+@param <SignatureType> The signature of this DelegateBase<> object's Action<>
+*/
+template <typename SignatureType>
+class DelegateBase;
+
+/**
+Provides the Action<> storage, subscriptions, and cached invocation lists shared by Delegate<> and Signal<>
+@param <ReturnType> The return type of this DelegateBase<> object's Action<>
+@param <...Args> The argument types of this DelegateBase<> object's Action<>
+    @note Every subscriber of and subscription to a DelegateBase<> must be a DelegateBase<> with the same SignatureType
+*/
+template <typename ReturnType, typename ...Args>
+class DelegateBase<ReturnType(Args...)>
+    : protected Subscribable
+{
+public:
+    /**
+    The size in bytes of the inline buffer used to store a DelegateBase<> object's Action<>
+    */
+    static constexpr size_t Capacity { DYNAMIC_STATIC_DELEGATE_CAPACITY };
+
+protected:
+    friend class Subscribable;
+
+    template <auto Method, typename T>
+    struct MethodAction final
+    {
+        inline ReturnType operator()(Args... args) const
+        {
+            if constexpr (std::is_void<ReturnType>::value) {
+                (pObject->*Method)(std::forward<Args>(args)...);
+            } else {
+                return (pObject->*Method)(std::forward<Args>(args)...);
+            }
+        }
+
+        T* pObject { nullptr };
+    };
+
+    using ActionStorage = InlineFunction<ReturnType(Args...), Capacity>;
+
+    /**
+    Constructs an instance of DelegateBase<>
+    */
+    DelegateBase() = default;
+
+    /**
+    Constructs an instance of DelegateBase<>
+    @param <ActionType> The type of object to assign to this DelegateBase<> object's Action<>
+    @param [in] action This DelegateBase<> object's Action<>
+    */
+    template <typename ActionType>
+    inline DelegateBase(ActionType action)
+        : mAction { std::move(action) }
+    {
+    }
+
+    /**
+    Moves an instance of DelegateBase<>
+    @param [in] other The DelegateBase<> to move from
+    */
+    inline DelegateBase(DelegateBase<ReturnType(Args...)>&& other) noexcept
+    {
+        *this = std::move(other);
+    }
+
+    /**
+    Moves an instance of DelegateBase<>
+    @param [in] other The DelegateBase<> to move from
+    @return A reference to this DelegateBase<>
+    */
+    inline DelegateBase<ReturnType(Args...)>& operator=(DelegateBase<ReturnType(Args...)>&& other) noexcept
+    {
+        Subscribable::operator=(std::move(other));
+        mAction = std::move(other.mAction);
+        other.mAction = nullptr;
+        other.invalidate_invocation_lists();
+        invalidate_invocation_lists();
+        return *this;
+    }
+
+    /**
+    Assigns this DelegateBase<> object's Action<>
+    @param <ActionType> The type of object to assign to this DelegateBase<> object's Action<>
+    @param [in] action This DelegateBase<> object's Action<>
+    */
+    template <typename ActionType>
+    inline void set_action(ActionType action)
+    {
+        mAction = std::move(action);
+        invalidate_invocation_lists();
+    }
+
+    /**
+    Assigns this DelegateBase<> object's Action<> to call a specified member function on a specified object
+    @param <Method> The member function to call
+    @param <T> The type of object to call the member function on
+    @param [in] object The object to call the member function on
+    */
+    template <auto Method, typename T>
+    inline void bind_action(T& object)
+    {
+        set_action(MethodAction<Method, T> { &object });
+    }
+
+    /**
+    Calls a given function with this DelegateBase<> object's Action<> and that of all subscribed DelegateBase<> objects (recursively)
+    @param <FunctionType> The type of function to call
+    @param [in] function The function to call with each Action<>, returns whether or not to continue to the next Action<>
+        @note When DYNAMIC_STATIC_EVENT_PROFILING_ENABLED is defined the call is recorded with EventProfiler
+    */
+    template <typename FunctionType>
+    inline void for_each_action(FunctionType&& function) const
+    {
+        std::vector<const ActionStorage*> temporaryInvocationList;
+        const auto& invocationList = get_invocation_list(temporaryInvocationList);
+        #ifdef DYNAMIC_STATIC_EVENT_PROFILING_ENABLED
+        EventProfiler::Scope profilerScope(mProfilerId, this, typeid(*this).name(), invocationList.size());
+        #endif
+        for (auto pAction : invocationList) {
+            if (!function(*pAction)) {
+                break;
+            }
+        }
+    }
+
+    /**
+    Clears this DelegateBase<> object's Action<>
+    */
+    inline void clear_action()
+    {
+        mAction = nullptr;
+        invalidate_invocation_lists();
+    }
+
+    /**
+    Gets the cached list of this DelegateBase<> object's Action<> and those of all subscribed DelegateBase<> objects (recursively)
+    @param [in] temporaryInvocationList A list to build into if another thread is building the cached list
+    @return The cached list, or the given temporary list if another thread is building the cached list
+    */
+    inline const std::vector<const ActionStorage*>& get_invocation_list(std::vector<const ActionStorage*>& temporaryInvocationList) const
+    {
+        // NOTE : Only the thread that moves mInvocationListState from Dirty to Building
+        //  writes mInvocationList.  Threads that call this DelegateBase<> while the
+        //  list is being built build a temporary list rather than waiting.
+        auto state = mInvocationListState.load(std::memory_order_acquire);
+        if (state == InvocationListState::Dirty && mInvocationListState.compare_exchange_strong(state, InvocationListState::Building, std::memory_order_acquire)) {
+            build_invocation_list(mInvocationList);
+            mInvocationListState.store(InvocationListState::Clean, std::memory_order_release);
+            return mInvocationList;
+        }
+        if (state == InvocationListState::Clean) {
+            return mInvocationList;
+        }
+        build_invocation_list(temporaryInvocationList);
+        return temporaryInvocationList;
+    }
+
+    #ifdef DYNAMIC_STATIC_EVENT_PROFILING_ENABLED
+    /**
+    Gets this DelegateBase<> object's EventProfiler id
+    @return This DelegateBase<> object's EventProfiler id
+    */
+    inline uint64_t get_profiler_id() const
+    {
+        return mProfilerId;
+    }
+    #endif
+
+private:
+    enum class InvocationListState : uint8_t
+    {
+        Dirty,
+        Building,
+        Clean,
+    };
+
+    inline void invalidate_invocation_lists()
+    {
+        // NOTE : The invocation list of every DelegateBase<> that this DelegateBase<>
+        //  is subscribed to (recursively) includes this DelegateBase<>, so they're
+        //  marked dirty along with this DelegateBase<>.  mSubscriptionsInvalidated
+        //  records that a DelegateBase<> and everything it's subscribed to
+        //  (recursively) is already dirty so the walk stops there, it's cleared when
+        //  an invocation list that includes the DelegateBase<> is built.
+        mInvocationListState.store(InvocationListState::Dirty, std::memory_order_relaxed);
+        if (!mSubscriptionsInvalidated.exchange(true, std::memory_order_relaxed)) {
+            std::vector<DelegateBase<ReturnType(Args...)>*> delegates;
+            for (auto pDelegate = this; pDelegate;) {
+                for (auto pSubscription : pDelegate->Subscribable::get_subscriptions()) {
+                    auto pSubscriptionDelegate = static_cast<DelegateBase<ReturnType(Args...)>*>(pSubscription);
+                    if (!pSubscriptionDelegate->mSubscriptionsInvalidated.exchange(true, std::memory_order_relaxed)) {
+                        pSubscriptionDelegate->mInvocationListState.store(InvocationListState::Dirty, std::memory_order_relaxed);
+                        delegates.push_back(pSubscriptionDelegate);
+                    }
+                }
+                pDelegate = nullptr;
+                if (!delegates.empty()) {
+                    pDelegate = delegates.back();
+                    delegates.pop_back();
+                }
+            }
+        }
+    }
+
+    inline void on_subscribers_changed() override final
+    {
+        invalidate_invocation_lists();
+    }
+
+    inline void build_invocation_list(std::vector<const ActionStorage*>& invocationList) const
+    {
+        // NOTE : The subscription graph is walked depth first with an explicit stack
+        //  so deep subscription chains don't recurse.  Subscribers are pushed in
+        //  reverse so they're visited in the order they were subscribed in.
+        invocationList.clear();
+        std::unordered_set<const DelegateBase<ReturnType(Args...)>*> visited;
+        std::vector<const DelegateBase<ReturnType(Args...)>*> stack { this };
+        while (!stack.empty()) {
+            auto pDelegate = stack.back();
+            stack.pop_back();
+            if (visited.insert(pDelegate).second) {
+                pDelegate->mSubscriptionsInvalidated.store(false, std::memory_order_relaxed);
+                if (pDelegate->mAction) {
+                    invocationList.push_back(&pDelegate->mAction);
+                }
+                const auto& subscribers = pDelegate->Subscribable::get_subscribers();
+                for (auto itr = subscribers.end(); itr != subscribers.begin();) {
+                    stack.push_back(static_cast<const DelegateBase<ReturnType(Args...)>*>(*--itr));
+                }
+            }
+        }
+    }
+
+    ActionStorage mAction;
+    mutable std::vector<const ActionStorage*> mInvocationList;
+    mutable std::atomic<InvocationListState> mInvocationListState { InvocationListState::Dirty };
+    mutable std::atomic_bool mSubscriptionsInvalidated { false };
+    #ifdef DYNAMIC_STATIC_EVENT_PROFILING_ENABLED
+    uint64_t mProfilerId { EventProfiler::create_id() };
+    #endif
+};
+
+} // namespace detail
+} // namespace dst
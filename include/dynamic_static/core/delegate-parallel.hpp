@@ -0,0 +1,59 @@
+/*
+==========================================
+  Copyright (c) 2020 Dynamic_Static
+    Patrick Purcell
+      Licensed under the MIT license
+    http://opensource.org/licenses/MIT
+==========================================
+*/
+
+#pragma once
+
+#include "dynamic_static/core/defines.hpp"
+#include "dynamic_static/core/delegate.hpp"
+#include "dynamic_static/core/parallel.hpp"
+#include "dynamic_static/core/thread-pool.hpp"
+
+#ifdef DYNAMIC_STATIC_EVENT_PROFILING_ENABLED
+#include <typeinfo>
+#endif
+#include <vector>
+
+namespace dst {
+
+/**
+Calls a given Delegate<> object's Action<> and that of all subscribed Delegate<> objects (recursively) with the given arguments, splitting subscribed Delegate<> objects across a given ThreadPool
+@param <...Args> The argument types of the given Delegate<>
+@param [in] threadPool The ThreadPool to call subscribed Delegate<> objects on
+@param [in] delegate The Delegate<> to call
+@param [in] serialThreshold The number of subscribed Delegate<> objects below which they're called serially on the calling thread
+@param [in] args The arguments to call the given Delegate<> object's Action<> and all subscribed Delegate<> objects (recursively) with
+    @note serialThreshold is compared with the number of Action<> objects to call, ie. the number of Delegate<> objects with an Action<> reachable from the given Delegate<>
+    @note This function returns after all Action<> objects have been called, the calling thread processes pending tasks while it waits so this function may be called from the given ThreadPool object's threads
+    @note Action<> objects may be called concurrently so they must be safe to call concurrently with each other, each call receives its own copy of by value arguments
+    @note The same restrictions on adding, removing, moving, and destroying Delegate<> objects as Delegate<>::operator()() apply
+    @note An Event<> can be passed by its CallerType
+*/
+template <typename ...Args>
+inline void parallel_invoke(ThreadPool& threadPool, const Delegate<Args...>& delegate, size_t serialThreshold, typename detail::NonDeduced<Args>::type... args)
+{
+    std::vector<const typename Delegate<Args...>::ActionStorage*> temporaryInvocationList;
+    const auto& invocationList = delegate.get_invocation_list(temporaryInvocationList);
+    #ifdef DYNAMIC_STATIC_EVENT_PROFILING_ENABLED
+    EventProfiler::Scope profilerScope(delegate.get_profiler_id(), &delegate, typeid(delegate).name(), invocationList.size());
+    #endif
+    if (invocationList.size() < serialThreshold) {
+        for (auto pAction : invocationList) {
+            (*pAction)(Args(args)...);
+        }
+    } else {
+        parallel_for(threadPool, (size_t)0, invocationList.size(), (size_t)0,
+            [&](size_t i)
+            {
+                (*invocationList[i])(Args(args)...);
+            }
+        );
+    }
+}
+
+} // namespace dst
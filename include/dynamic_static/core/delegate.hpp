@@ -12,6 +12,7 @@
 
 #include "dynamic_static/core/action.hpp"
 #include "dynamic_static/core/defines.hpp"
+#include "dynamic_static/core/delegate-base.hpp"
 #include "dynamic_static/core/subscribable.hpp"
 
 #include <functional>
@@ -19,15 +20,47 @@
 
 namespace dst {
 
+class ThreadPool;
+
+namespace detail {
+
+/**
+Prevents a function parameter from participating in template argument deduction
+@param <T> The type of the parameter
+*/
+template <typename T>
+struct NonDeduced final
+{
+    using type = T;
+};
+
+} // namespace detail
+
+template <typename ...Args>
+class Delegate;
+
+template <typename ...Args>
+inline void parallel_invoke(ThreadPool& threadPool, const Delegate<Args...>& delegate, size_t serialThreshold, typename detail::NonDeduced<Args>::type... args);
+
 /**
 Encapsulates a Subscribable multicast Action<>
 @param <...Args> The argument types of thie Delegate<> object's Action<>
+    @note A Delegate<> object's Action<> is stored in an InlineFunction<> so assigning it never allocates, Action<> types larger than Capacity are rejected at compile time
+    @note Define DYNAMIC_STATIC_DELEGATE_CAPACITY before including this file to change Capacity
+    @note Include delegate-parallel.hpp to call a Delegate<> on a ThreadPool with parallel_invoke()
+    @note Enable the DST_CORE_EVENT_PROFILING CMake option to record calls with EventProfiler, see EventProfiler for details
+    @note Calling a Delegate<> walks a cached list of the Action<> objects of it and its subscribed Delegate<> objects (recursively), the list is rebuilt on the next call after a Delegate<> it includes changes its Action<> or subscribers
 */
 template <typename ...Args>
 class Delegate
-    : private Subscribable
+    : private detail::DelegateBase<void(Args...)>
 {
 public:
+    /**
+    The size in bytes of the inline buffer used to store a Delegate<> object's Action<>
+    */
+    static constexpr size_t Capacity { detail::DelegateBase<void(Args...)>::Capacity };
+
     /**
     Constructs an instance of Delegate<>
     */
@@ -38,11 +71,12 @@ public:
     @param <ActionType> The type of object to assign to this Delegate<> object's Action<>
     @param [in] action This Delegate<> object's Action<>
         @note ActionType must have a signautre compatible with this Delegate<> object's <...Args> parameter
+        @note ActionType must fit in Capacity and be nothrow move constructible
         @note Passing nullptr for action will clear this Delegate<> object's Action<>
     */
     template <typename ActionType>
     inline Delegate(ActionType action)
-        : mAction { action }
+        : detail::DelegateBase<void(Args...)>(std::move(action))
     {
     }
 
@@ -52,12 +86,28 @@ public:
     @param [in] action This Delegate<> object's Action<>
     @return A reference to this Delegate<>
         @note ActionType must have a signautre compatible with this Delegate<> object's <...Args> parameter
+        @note ActionType must fit in Capacity and be nothrow move constructible
         @note Passing nullptr for action will clear this Delegate<> object's Action<>
     */
     template <typename ActionType>
     inline Delegate<Args...>& operator=(ActionType action)
     {
-        mAction = action;
+        this->set_action(std::move(action));
+        return *this;
+    }
+
+    /**
+    Assigns this Delegate<> object's Action<> to call a specified member function on a specified object
+    @param <Method> The member function to call
+    @param <T> The type of object to call the member function on
+    @param [in] object The object to call the member function on
+    @return A reference to this Delegate<>
+        @note Only a pointer to the given object is stored, the object must outlive this Delegate<> object's Action<>
+    */
+    template <auto Method, typename T>
+    inline Delegate<Args...>& bind(T& object)
+    {
+        this->template bind_action<Method>(object);
         return *this;
     }
 
@@ -77,9 +127,7 @@ public:
     */
     inline Delegate<Args...>& operator=(Delegate<Args...>&& other) noexcept
     {
-        Subscribable::operator=(std::move(other));
-        mAction = std::move(other.mAction);
-        other.mAction = nullptr;
+        detail::DelegateBase<void(Args...)>::operator=(std::move(other));
         return *this;
     }
 
@@ -101,6 +149,7 @@ public:
     @param [in] subscriber The Delegate<> unsubscribing from this Delegate<>
     @return A reference to this Delegate<>
         @note This method is a noop if the given Delegate<> is not subscribed to this Delegate<>
+        @note Finding the given Delegate<> is linear in this Delegate<> object's number of subscribers, use subscribe() to get a Subscription that's removed in O(1)
     */
     inline Delegate<Args...>& operator-=(Delegate<Args...>& subscriber)
     {
@@ -108,22 +157,38 @@ public:
         return *this;
     }
 
+    /**
+    Adds a subscriber to this Delegate<> and gets a Subscription that removes it
+    @param [in] subscriber The Delegate<> subscribing to this Delegate<>
+    @return A Subscription that removes the subscription when it's destroyed or reset, or an empty Subscription if this method is a noop
+        @note This method is a noop if it would cause a duplicate subscription
+        @note This method is a noop if it would cause a self subscription
+    */
+    inline Subscription subscribe(Delegate<Args...>& subscriber)
+    {
+        return Subscribable::subscribe(subscriber);
+    }
+
     /**
     Calls this Delegate<> object's Action<> and that of all subscribed Delegate<> objects (recursively) with the given arguments
     @param [in] args The arguments to call this Delegate<> object's Action<> and all subscribed Delegate<> objects (recursively) with
-        @note The order that subscribed Delegate<> objects are called in is nondetermninistic; ie. it is not the order they were subscribed in
+        @note Subscribed Delegate<> objects are called in the order they were subscribed in, depth first
+        @note Each Delegate<> is called once per call even if it's reachable through more than one subscription, subscription cycles are allowed
         @note This Delegate<> object and subscribed Delegate<> objects (recursively) must not add or remove subscribers during the scope of this method
         @note This Delegate<> object and subscribed Delegate<> objects (recursively) must not std::move() during the scope of this method
         @note This Delegate<> object and subscribed Delegate<> objects (recursively) must not be destroyed during the scope of this method
+        @note Exceptions thrown by Action<> objects will call std::terminate()
+        @note This Delegate<> may be called from multiple threads at once, the first call after a change rebuilds the cached list of Action<> objects while concurrent calls build a temporary list
     */
     inline void operator()(Args&&... args) const
     {
-        if (mAction) {
-            mAction(std::forward<Args>(args)...);
-        }
-        for (auto pSubscriber : Subscribable::get_subscribers()) {
-            (*(const Delegate<Args...>*)pSubscriber)(std::forward<Args>(args)...);
-        }
+        this->for_each_action(
+            [&](const auto& action)
+            {
+                action(std::forward<Args>(args)...);
+                return true;
+            }
+        );
     }
 
     /**
@@ -147,13 +212,28 @@ public:
     */
     inline void clear()
     {
-        mAction = nullptr;
+        this->clear_action();
         clear_subscribers();
         clear_subscriptions();
     }
 
+    /**
+    Removes all subscribers from and subscriptions to a range of Delegate<> objects
+    @param <IteratorType> The type of iterator used to traverse the range
+    @param [in] begin The beginning of the range
+    @param [in] end The end of the range
+        @note See Subscribable::clear() for details
+    */
+    template <typename IteratorType>
+    static inline void clear(IteratorType begin, IteratorType end)
+    {
+        Subscribable::clear(begin, end);
+    }
+
 private:
-    Action<Args...> mAction;
+    friend class Subscribable;
+    template <typename ...DelegateArgs>
+    friend void parallel_invoke(ThreadPool& threadPool, const Delegate<DelegateArgs...>& delegate, size_t serialThreshold, typename detail::NonDeduced<DelegateArgs>::type... args);
 };
 
 } // namespace dst
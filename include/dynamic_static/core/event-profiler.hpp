@@ -0,0 +1,184 @@
+/*
+==========================================
+  Copyright (c) 2020 Dynamic_Static
+    Patrick Purcell
+      Licensed under the MIT license
+    http://opensource.org/licenses/MIT
+==========================================
+*/
+
+#pragma once
+
+#include "dynamic_static/core/defines.hpp"
+#include "dynamic_static/core/time.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <ostream>
+#include <unordered_map>
+#include <vector>
+
+namespace dst {
+
+/**
+Aggregates the number of calls, subscribers, and elapsed time of Delegate<> and Event<> calls
+    @note Delegate<>, Event<>, and Signal<> calls are only recorded when DYNAMIC_STATIC_EVENT_PROFILING_ENABLED is defined, otherwise the hooks aren't compiled and EventProfiler stays empty
+    @note DYNAMIC_STATIC_EVENT_PROFILING_ENABLED is defined for dynamic_static.core and every target that links it by the DST_CORE_EVENT_PROFILING CMake option, it must not be defined per translation unit since that gives inline Delegate<> methods different definitions
+    @note EventProfiler methods may be called from any thread
+*/
+class EventProfiler final
+{
+public:
+    /**
+    The aggregated calls of a single Delegate<> or Event<>
+    */
+    struct Entry final
+    {
+        uint64_t id { 0 };                 //!< The id of the Delegate<> or Event<> that was called, each Delegate<> or Event<> gets a unique id from create_id() when it's constructed
+        const void* pAddress { nullptr };  //!< The address of the Delegate<> or Event<> when it was last called
+        const char* pTypeName { nullptr }; //!< The implementation defined type name of the Delegate<> or Event<> that was called
+        uint64_t callCount { 0 };          //!< The number of times the Delegate<> or Event<> was called
+        uint64_t subscriberCount { 0 };    //!< The total number of Action<> objects called across all calls
+        uint64_t totalNanoseconds { 0 };   //!< The total elapsed time of all calls in nanoseconds
+        uint64_t maxNanoseconds { 0 };     //!< The elapsed time of the longest call in nanoseconds
+    };
+
+    /**
+    Records a call while in scope
+    */
+    class Scope final
+    {
+    public:
+        /**
+        Constructs an instance of EventProfiler::Scope
+        @param [in] id The id of the Delegate<> or Event<> being called
+        @param [in] pAddress The address of the Delegate<> or Event<> being called
+        @param [in] pTypeName The implementation defined type name of the Delegate<> or Event<> being called
+        @param [in] subscriberCount The number of Action<> objects being called
+        */
+        inline Scope(uint64_t id, const void* pAddress, const char* pTypeName, size_t subscriberCount)
+            : mId { id }
+            , mpAddress { pAddress }
+            , mpTypeName { pTypeName }
+            , mSubscriberCount { subscriberCount }
+        {
+        }
+
+        /**
+        Destroys this instance of EventProfiler::Scope, recording the elapsed time since construction
+        */
+        inline ~Scope()
+        {
+            EventProfiler::record(mId, mpAddress, mpTypeName, mSubscriberCount, (uint64_t)mTimer.total<Nanoseconds<uint64_t>>());
+        }
+
+    private:
+        uint64_t mId { 0 };
+        const void* mpAddress { nullptr };
+        const char* mpTypeName { nullptr };
+        size_t mSubscriberCount { 0 };
+        Timer mTimer;
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+    };
+
+    /**
+    Gets a new unique id for a Delegate<> or Event<>
+    @return A new unique id for a Delegate<> or Event<>
+        @note Entries are keyed by id rather than address so a Delegate<> or Event<> constructed at the address of a destroyed one gets its own Entry
+    */
+    static inline uint64_t create_id()
+    {
+        static std::atomic<uint64_t> sIdCounter { 0 };
+        return ++sIdCounter;
+    }
+
+    /**
+    Records a call
+    @param [in] id The id of the Delegate<> or Event<> that was called
+    @param [in] pAddress The address of the Delegate<> or Event<> that was called
+    @param [in] pTypeName The implementation defined type name of the Delegate<> or Event<> that was called
+    @param [in] subscriberCount The number of Action<> objects called
+    @param [in] nanoseconds The elapsed time of the call in nanoseconds
+    */
+    static inline void record(uint64_t id, const void* pAddress, const char* pTypeName, size_t subscriberCount, uint64_t nanoseconds)
+    {
+        auto& state = get_state();
+        std::lock_guard<std::mutex> lock(state.mutex);
+        auto& entry = state.entries[id];
+        entry.id = id;
+        entry.pAddress = pAddress;
+        entry.pTypeName = pTypeName;
+        ++entry.callCount;
+        entry.subscriberCount += subscriberCount;
+        entry.totalNanoseconds += nanoseconds;
+        entry.maxNanoseconds = std::max(entry.maxNanoseconds, nanoseconds);
+    }
+
+    /**
+    Gets recorded Entry objects sorted by total elapsed time, longest first
+    @param [in] count (optional = all) The maximum number of Entry objects to get
+    @return Recorded Entry objects sorted by total elapsed time, longest first
+    */
+    static inline std::vector<Entry> get_entries(size_t count = (size_t)-1)
+    {
+        std::vector<Entry> entries;
+        {
+            auto& state = get_state();
+            std::lock_guard<std::mutex> lock(state.mutex);
+            entries.reserve(state.entries.size());
+            for (const auto& itr : state.entries) {
+                entries.push_back(itr.second);
+            }
+        }
+        auto compare = [](const Entry& lhs, const Entry& rhs) { return lhs.totalNanoseconds > rhs.totalNanoseconds; };
+        count = std::min(count, entries.size());
+        std::partial_sort(entries.begin(), entries.begin() + count, entries.end(), compare);
+        entries.resize(count);
+        return entries;
+    }
+
+    /**
+    Writes recorded Entry objects with the longest total elapsed time to a given std::ostream
+    @param [in] strm The std::ostream to write to
+    @param [in] count (optional = 10) The maximum number of Entry objects to write
+    */
+    static inline void dump(std::ostream& strm, size_t count = 10)
+    {
+        for (const auto& entry : get_entries(count)) {
+            strm << entry.pTypeName << " #" << entry.id << " @ " << entry.pAddress
+                << " : " << entry.callCount << " calls"
+                << ", " << (entry.callCount ? entry.subscriberCount / entry.callCount : 0) << " subscribers/call"
+                << ", " << entry.totalNanoseconds << " ns total"
+                << ", " << entry.maxNanoseconds << " ns max"
+                << std::endl;
+        }
+    }
+
+    /**
+    Removes all recorded Entry objects
+    */
+    static inline void reset()
+    {
+        auto& state = get_state();
+        std::lock_guard<std::mutex> lock(state.mutex);
+        state.entries.clear();
+    }
+
+private:
+    struct State final
+    {
+        std::mutex mutex;
+        std::unordered_map<uint64_t, Entry> entries;
+    };
+
+    static inline State& get_state()
+    {
+        static State sState;
+        return sState;
+    }
+};
+
+} // namespace dst
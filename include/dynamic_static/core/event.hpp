@@ -22,6 +22,7 @@ namespace dst {
 Encapsulates a Subscribable multicast Action<> that can be exectued by a specified type
 @param <CallerType> The type that can execute this Event<>
 @param <...Args> This Event<> object's argument types
+    @note CallerType can call this Event<> on a ThreadPool by passing it to parallel_invoke(), see delegate-parallel.hpp
 */
 template <typename CallerType, typename ...Args>
 class Event
@@ -55,6 +56,17 @@ public:
         return *this;
     }
 
+    /**
+    Adds a subscriber to this Event<> and gets a Subscription that removes it
+    @param [in] subscriber The Delegate<> subscribing to this Event<>
+    @return A Subscription that removes the subscription when it's destroyed or reset, or an empty Subscription if this method is a noop
+        @note This method is a noop if it would cause a duplicate subscription
+    */
+    inline Subscription subscribe(Delegate<Args...>& subscriber)
+    {
+        return Delegate<Args...>::subscribe(subscriber);
+    }
+
 private:
     /**
     Constructs an instance of Event<>
@@ -84,10 +96,11 @@ private:
     /**
     Calls this Event<> object's subscribed Delegate<> objects (recursively) with the given arguments
     @param [in] args The arguments to call this Event<> object's subscribed Delegate<> objects (recursively) with
-        @note The order that subscribed Delegate<> objects are called in is nondetermninistic; ie. it is not the order they were subscribed in
+        @note Subscribed Delegate<> objects are called in the order they were subscribed in
         @note This Event<> object and subscribed Delegate<> objects (recursively) must not add or remove subscribers during the scope of this method
         @note This Event<> object and subscribed Delegate<> objects (recursively) must not std::move() during the scope of this method
         @note This Event<> object and subscribed Delegate<> objects (recursively) must not be destroyed during the scope of this method
+        @note When the DST_CORE_EVENT_PROFILING CMake option is enabled calls are recorded with EventProfiler under this Event<> object's id and type name
     */
     inline void operator()(Args&&... args) const
     {
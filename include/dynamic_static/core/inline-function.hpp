@@ -0,0 +1,242 @@
+/*
+==========================================
+  Copyright (c) 2020 Dynamic_Static
+    Patrick Purcell
+      Licensed under the MIT license
+    http://opensource.org/licenses/MIT
+==========================================
+*/
+
+#pragma once
+
+#include "dynamic_static/core/defines.hpp"
+
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace dst {
+
+/**
+Move only callable wrapper that stores its target in a fixed size inline buffer
+@param <SignatureType> The signature of this InlineFunction<> object's target
+@param <Capacity> The size in bytes of this InlineFunction<> object's inline buffer
+    @note InlineFunction<> never allocates, targets that don't fit in the inline buffer are rejected at compile time
+*/
+template <typename SignatureType, size_t Capacity = 4 * sizeof(void*)>
+class InlineFunction;
+
+/**
+Move only callable wrapper that stores its target in a fixed size inline buffer
+@param <ReturnType> The return type of this InlineFunction<> object's target
+@param <...Args> The argument types of this InlineFunction<> object's target
+@param <Capacity> The size in bytes of this InlineFunction<> object's inline buffer
+    @note InlineFunction<> never allocates, targets that don't fit in the inline buffer are rejected at compile time
+*/
+template <typename ReturnType, typename ...Args, size_t Capacity>
+class InlineFunction<ReturnType(Args...), Capacity> final
+{
+public:
+    /**
+    Gets a value indicating whether or not a given type can be stored in an InlineFunction<>
+    @param <FunctionType> The type to check
+    */
+    template <typename FunctionType>
+    static constexpr bool is_storable()
+    {
+        using DecayedType = typename std::decay<FunctionType>::type;
+        return
+            sizeof(DecayedType) <= Capacity &&
+            alignof(DecayedType) <= alignof(std::max_align_t) &&
+            std::is_nothrow_move_constructible<DecayedType>::value;
+    }
+
+    /**
+    Constructs an instance of InlineFunction<>
+    */
+    InlineFunction() = default;
+
+    /**
+    Constructs an instance of InlineFunction<>
+    */
+    inline InlineFunction(std::nullptr_t)
+    {
+    }
+
+    /**
+    Constructs an instance of InlineFunction<>
+    @param <FunctionType> The type of this InlineFunction<> object's target
+    @param [in] function This InlineFunction<> object's target
+        @note FunctionType must have a signature compatible with this InlineFunction<> object's <SignatureType>
+    */
+    template <
+        typename FunctionType,
+        typename = typename std::enable_if<!std::is_same<typename std::decay<FunctionType>::type, InlineFunction>::value>::type
+    >
+    inline InlineFunction(FunctionType&& function)
+    {
+        assign(std::forward<FunctionType>(function));
+    }
+
+    /**
+    Moves an instance of InlineFunction<>
+    @param [in] other The InlineFunction<> to move from
+    */
+    inline InlineFunction(InlineFunction&& other) noexcept
+    {
+        *this = std::move(other);
+    }
+
+    /**
+    Destroys this instance of InlineFunction<>
+    */
+    inline ~InlineFunction()
+    {
+        reset();
+    }
+
+    /**
+    Moves an instance of InlineFunction<>
+    @param [in] other The InlineFunction<> to move from
+    @return A reference to this InlineFunction<>
+    */
+    inline InlineFunction& operator=(InlineFunction&& other) noexcept
+    {
+        if (this != &other) {
+            reset();
+            if (other.mpInvoke) {
+                if (other.mpManage) {
+                    other.mpManage(Operation::Move, &other.mStorage, &mStorage);
+                    other.mpManage(Operation::Destroy, &other.mStorage, nullptr);
+                } else {
+                    std::memcpy(&mStorage, &other.mStorage, Capacity);
+                }
+                mpInvoke = other.mpInvoke;
+                mpManage = other.mpManage;
+                other.mpInvoke = nullptr;
+                other.mpManage = nullptr;
+            }
+        }
+        return *this;
+    }
+
+    /**
+    Assigns this InlineFunction<> object's target
+    @param <FunctionType> The type of this InlineFunction<> object's target
+    @param [in] function This InlineFunction<> object's target
+    @return A reference to this InlineFunction<>
+        @note FunctionType must have a signature compatible with this InlineFunction<> object's <SignatureType>
+    */
+    template <
+        typename FunctionType,
+        typename = typename std::enable_if<!std::is_same<typename std::decay<FunctionType>::type, InlineFunction>::value>::type
+    >
+    inline InlineFunction& operator=(FunctionType&& function)
+    {
+        reset();
+        assign(std::forward<FunctionType>(function));
+        return *this;
+    }
+
+    /**
+    Clears this InlineFunction<> object's target
+    @return A reference to this InlineFunction<>
+    */
+    inline InlineFunction& operator=(std::nullptr_t)
+    {
+        reset();
+        return *this;
+    }
+
+    /**
+    Gets a value indicating whether or not this InlineFunction<> has a target
+    @return Whether or not this InlineFunction<> has a target
+    */
+    inline explicit operator bool() const
+    {
+        return mpInvoke != nullptr;
+    }
+
+    /**
+    Calls this InlineFunction<> object's target with the given arguments
+    @param [in] args The arguments to call this InlineFunction<> object's target with
+    @return The value returned by this InlineFunction<> object's target
+        @note This InlineFunction<> must have a target
+        @note Exceptions thrown by this InlineFunction<> object's target will call std::terminate()
+    */
+    inline ReturnType operator()(Args... args) const noexcept
+    {
+        return mpInvoke(const_cast<void*>(static_cast<const void*>(&mStorage)), std::forward<Args>(args)...);
+    }
+
+private:
+    enum class Operation
+    {
+        Move,
+        Destroy,
+    };
+
+    template <typename FunctionType>
+    inline void assign(FunctionType&& function)
+    {
+        using DecayedType = typename std::decay<FunctionType>::type;
+        static_assert(is_storable<DecayedType>(), "InlineFunction<> target must fit in Capacity and be nothrow move constructible");
+        if (is_empty(function)) {
+            return;
+        }
+        new (&mStorage) DecayedType(std::forward<FunctionType>(function));
+        mpInvoke = [](void* pStorage, Args&&... args) -> ReturnType
+        {
+            if constexpr (std::is_void<ReturnType>::value) {
+                (*static_cast<DecayedType*>(pStorage))(std::forward<Args>(args)...);
+            } else {
+                return (*static_cast<DecayedType*>(pStorage))(std::forward<Args>(args)...);
+            }
+        };
+        if (!std::is_trivially_copyable<DecayedType>::value || !std::is_trivially_destructible<DecayedType>::value) {
+            mpManage = [](Operation operation, void* pSrc, void* pDst)
+            {
+                switch (operation) {
+                case Operation::Move: new (pDst) DecayedType(std::move(*static_cast<DecayedType*>(pSrc))); break;
+                case Operation::Destroy: static_cast<DecayedType*>(pSrc)->~DecayedType(); break;
+                }
+            };
+        }
+    }
+
+    template <typename FunctionType>
+    static inline bool is_empty(const FunctionType& function)
+    {
+        if constexpr (std::is_pointer<FunctionType>::value || std::is_member_pointer<FunctionType>::value) {
+            return function == nullptr;
+        } else {
+            return false;
+        }
+    }
+
+    template <typename SignatureType>
+    static inline bool is_empty(const std::function<SignatureType>& function)
+    {
+        return !function;
+    }
+
+    inline void reset()
+    {
+        if (mpManage) {
+            mpManage(Operation::Destroy, &mStorage, nullptr);
+        }
+        mpInvoke = nullptr;
+        mpManage = nullptr;
+    }
+
+    alignas(std::max_align_t) unsigned char mStorage[Capacity];
+    ReturnType(*mpInvoke)(void*, Args&&...) { nullptr };
+    void(*mpManage)(Operation, void*, void*) { nullptr };
+    InlineFunction(const InlineFunction&) = delete;
+    InlineFunction& operator=(const InlineFunction&) = delete;
+};
+
+} // namespace dst
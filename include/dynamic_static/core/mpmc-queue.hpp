@@ -0,0 +1,223 @@
+/*
+==========================================
+  Copyright (c) 2020 Dynamic_Static
+    Patrick Purcell
+      Licensed under the MIT license
+    http://opensource.org/licenses/MIT
+==========================================
+*/
+
+#pragma once
+
+#include "dynamic_static/core/defines.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace dst {
+
+/**
+Bounded lock free queue that supports any number of concurrent producers and consumers
+@param <T> The type of element stored in this MpmcQueue<>
+    @note Each slot has a sequence number that tells producers and consumers whether the slot is ready to be written or read, producers and consumers only contend on their own position counter
+    @note The enqueue and dequeue positions and each slot are padded to separate cache lines so producers and consumers don't invalidate each other's cache lines
+    @note T must be nothrow move constructible and nothrow destructible
+*/
+template <typename T>
+class MpmcQueue final
+{
+public:
+    /**
+    Constructs an instance of MpmcQueue<>
+    @param [in] capacity The minimum number of elements this MpmcQueue<> can store
+        @note capacity is rounded up to a power of two, at least 2
+    */
+    inline explicit MpmcQueue(size_t capacity)
+    {
+        static_assert(std::is_nothrow_move_constructible<T>::value, "MpmcQueue<> T must be nothrow move constructible");
+        static_assert(std::is_nothrow_destructible<T>::value, "MpmcQueue<> T must be nothrow destructible");
+        size_t slotCount = 2;
+        while (slotCount < capacity) {
+            slotCount <<= 1;
+        }
+        mMask = slotCount - 1;
+        mupSlots = std::make_unique<Slot[]>(slotCount);
+        for (size_t i = 0; i < slotCount; ++i) {
+            mupSlots[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+    Destroys this instance of MpmcQueue<>
+        @note Elements remaining in this MpmcQueue<> are destroyed
+    */
+    inline ~MpmcQueue()
+    {
+        auto enqueuePosition = mEnqueuePosition.load(std::memory_order_relaxed);
+        for (auto position = mDequeuePosition.load(std::memory_order_relaxed); position != enqueuePosition; ++position) {
+            get_value(mupSlots[position & mMask])->~T();
+        }
+    }
+
+    /**
+    Gets the number of elements this MpmcQueue<> can store
+    @return The number of elements this MpmcQueue<> can store
+    */
+    inline size_t capacity() const
+    {
+        return mMask + 1;
+    }
+
+    /**
+    Gets the number of elements in this MpmcQueue<>
+    @return The number of elements in this MpmcQueue<>
+        @note The value retuned by this method may be stale by the time it's read
+    */
+    inline size_t size() const
+    {
+        auto dequeuePosition = mDequeuePosition.load(std::memory_order_relaxed);
+        auto enqueuePosition = mEnqueuePosition.load(std::memory_order_relaxed);
+        return enqueuePosition > dequeuePosition ? std::min(enqueuePosition - dequeuePosition, capacity()) : 0;
+    }
+
+    /**
+    Gets a value indicating whether or not this MpmcQueue<> is empty
+    @return Whether or not this MpmcQueue<> is empty
+        @note The value retuned by this method may be stale by the time it's read
+    */
+    inline bool empty() const
+    {
+        return !size();
+    }
+
+    /**
+    Adds an element to this MpmcQueue<> if there's room
+    @param [in] value The element to add
+    @return Whether or not the element was added
+    */
+    inline bool try_push(const T& value)
+    {
+        return try_emplace(value);
+    }
+
+    /**
+    Adds an element to this MpmcQueue<> if there's room
+    @param [in] value The element to add
+    @return Whether or not the element was added, if the element wasn't added the given value isn't moved from
+    */
+    inline bool try_push(T&& value)
+    {
+        return try_emplace(std::move(value));
+    }
+
+    /**
+    Constructs an element in this MpmcQueue<> if there's room
+    @param <Args> The types of arguments used to construct the element
+    @param [in] args The arguments used to construct the element
+    @return Whether or not the element was constructed
+        @note If constructing T from the given arguments may throw, a temporary T is constructed first and moved into this MpmcQueue<>
+    */
+    template <typename ...Args>
+    inline bool try_emplace(Args&&... args)
+    {
+        if constexpr (std::is_nothrow_constructible<T, Args&&...>::value) {
+            size_t position = 0;
+            auto pSlot = acquire_enqueue_slot(position);
+            if (pSlot) {
+                new (&pSlot->storage) T(std::forward<Args>(args)...);
+                pSlot->sequence.store(position + 1, std::memory_order_release);
+            }
+            return pSlot != nullptr;
+        } else {
+            // NOTE : A slot that's been claimed must be published, so T is constructed
+            //  before claiming a slot when constructing T may throw.
+            T value(std::forward<Args>(args)...);
+            return try_emplace(std::move(value));
+        }
+    }
+
+    /**
+    Removes the oldest element from this MpmcQueue<> if there is one
+    @param [out] value The T to move the removed element into
+    @return Whether or not an element was removed
+        @note If moving into the given value throws, the element is still removed and the exception is rethrown
+    */
+    inline bool try_pop(T& value)
+    {
+        auto position = mDequeuePosition.load(std::memory_order_relaxed);
+        while (true) {
+            auto& slot = mupSlots[position & mMask];
+            auto sequence = slot.sequence.load(std::memory_order_acquire);
+            auto difference = (std::ptrdiff_t)sequence - (std::ptrdiff_t)(position + 1);
+            if (!difference) {
+                if (mDequeuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    try {
+                        value = std::move(*get_value(slot));
+                    } catch (...) {
+                        release_dequeue_slot(slot, position);
+                        throw;
+                    }
+                    release_dequeue_slot(slot, position);
+                    return true;
+                }
+            } else if (difference < 0) {
+                return false;
+            } else {
+                position = mDequeuePosition.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+private:
+    // NOTE : Slots are padded to separate cache lines so a producer writing one
+    //  slot doesn't invalidate the cache line of a consumer reading its neighbour.
+    struct alignas(64) Slot final
+    {
+        std::atomic_size_t sequence { 0 };
+        alignas(T) unsigned char storage[sizeof(T)];
+    };
+
+    static inline T* get_value(Slot& slot)
+    {
+        return std::launder(reinterpret_cast<T*>(&slot.storage));
+    }
+
+    inline Slot* acquire_enqueue_slot(size_t& position)
+    {
+        position = mEnqueuePosition.load(std::memory_order_relaxed);
+        while (true) {
+            auto& slot = mupSlots[position & mMask];
+            auto sequence = slot.sequence.load(std::memory_order_acquire);
+            auto difference = (std::ptrdiff_t)sequence - (std::ptrdiff_t)position;
+            if (!difference) {
+                if (mEnqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    return &slot;
+                }
+            } else if (difference < 0) {
+                return nullptr;
+            } else {
+                position = mEnqueuePosition.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    inline void release_dequeue_slot(Slot& slot, size_t position)
+    {
+        get_value(slot)->~T();
+        slot.sequence.store(position + mMask + 1, std::memory_order_release);
+    }
+
+    std::unique_ptr<Slot[]> mupSlots;
+    size_t mMask { 0 };
+    alignas(64) std::atomic_size_t mEnqueuePosition { 0 };
+    alignas(64) std::atomic_size_t mDequeuePosition { 0 };
+    MpmcQueue(const MpmcQueue&) = delete;
+    MpmcQueue& operator=(const MpmcQueue&) = delete;
+};
+
+} // namespace dst
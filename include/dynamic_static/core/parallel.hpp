@@ -0,0 +1,287 @@
+/*
+==========================================
+  Copyright (c) 2020 Dynamic_Static
+    Patrick Purcell
+      Licensed under the MIT license
+    http://opensource.org/licenses/MIT
+==========================================
+*/
+
+#pragma once
+
+#include "dynamic_static/core/defines.hpp"
+#include "dynamic_static/core/thread-pool.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace dst {
+namespace detail {
+
+/**
+Shared state for a range of chunks being processed by parallel_for() or parallel_reduce()
+@param <IndexType> The type of index used to traverse the range
+@param <ChunkFunctionType> The type of function called for each chunk
+*/
+template <typename IndexType, typename ChunkFunctionType>
+class ParallelRange final
+{
+public:
+    /**
+    Constructs an instance of ParallelRange<>
+    @param [in] threadPool The ThreadPool to process chunks on
+    @param [in] begin The beginning of the range
+    @param [in] end The end of the range
+    @param [in] grainSize The number of indices in each chunk, 0 to split adaptively
+    @param [in] chunkFunction The function to call with each chunk's index, beginning, and end
+    */
+    inline ParallelRange(ThreadPool& threadPool, IndexType begin, IndexType end, IndexType grainSize, ChunkFunctionType& chunkFunction)
+        : mThreadPool { threadPool }
+        , mBegin { begin }
+        , mEnd { end }
+        , mChunkFunction { chunkFunction }
+    {
+        auto count = (size_t)(end - begin);
+        if (!grainSize) {
+            // NOTE : Adaptive ranges use small chunks but only split the range into
+            //  one piece per thread (counting the calling thread) up front, pieces are
+            //  split further when they're stolen or when threads are idle.
+            auto threadCount = mThreadPool.get_thread_count() + 1;
+            grainSize = (IndexType)std::max(count / (MaxChunksPerThread * threadCount), (size_t)1);
+            mAdaptive = true;
+            mInitialSplitDepth = 0;
+            while (((size_t)1 << mInitialSplitDepth) < threadCount) {
+                ++mInitialSplitDepth;
+            }
+        }
+        mGrainSize = grainSize;
+        mChunkCount = (count + (size_t)grainSize - 1) / (size_t)grainSize;
+        mIncompleteChunkCount = mChunkCount;
+    }
+
+    /**
+    Gets this ParallelRange<> object's number of chunks
+    @return This ParallelRange<> object's number of chunks
+    */
+    inline size_t get_chunk_count() const
+    {
+        return mChunkCount;
+    }
+
+    /**
+    Processes all chunks, the calling thread processes chunks and pending tasks until all chunks are complete
+        @note If any chunk throws, the first exception thrown is rethrown after all chunks are complete
+    */
+    inline void process()
+    {
+        if (mChunkCount) {
+            process(0, mChunkCount, mInitialSplitDepth);
+            mThreadPool.process_pending_tasks_until([&]() { return !mIncompleteChunkCount.load(std::memory_order_acquire); });
+            if (mException) {
+                std::rethrow_exception(mException);
+            }
+        }
+    }
+
+private:
+    static constexpr size_t MaxChunksPerThread { 32 };
+    static constexpr size_t StolenSplitDepth { 2 };
+
+    struct RangeTask final
+    {
+        // NOTE : A RangeTask that's destroyed without being processed, ie. dropped by
+        //  ThreadPool::clear(), releases its chunks so that process() doesn't wait
+        //  forever.
+        inline RangeTask(ParallelRange& range, size_t chunkBegin, size_t chunkEnd, size_t splitDepth)
+            : pRange { &range }
+            , chunkBegin { chunkBegin }
+            , chunkEnd { chunkEnd }
+            , splitDepth { splitDepth }
+            , pushThreadId { std::this_thread::get_id() }
+        {
+        }
+
+        inline RangeTask(RangeTask&& other) noexcept
+            : pRange { std::exchange(other.pRange, nullptr) }
+            , chunkBegin { other.chunkBegin }
+            , chunkEnd { other.chunkEnd }
+            , splitDepth { other.splitDepth }
+            , pushThreadId { other.pushThreadId }
+        {
+        }
+
+        inline ~RangeTask()
+        {
+            if (pRange) {
+                pRange->release(chunkEnd - chunkBegin);
+            }
+        }
+
+        inline void operator()()
+        {
+            auto pRange = std::exchange(this->pRange, nullptr);
+            auto stolen = pRange->mAdaptive && std::this_thread::get_id() != pushThreadId;
+            pRange->process(chunkBegin, chunkEnd, stolen ? splitDepth + StolenSplitDepth : splitDepth);
+        }
+
+        ParallelRange* pRange { nullptr };
+        size_t chunkBegin { 0 };
+        size_t chunkEnd { 0 };
+        size_t splitDepth { 0 };
+        std::thread::id pushThreadId;
+    };
+
+    inline void process(size_t chunkBegin, size_t chunkEnd, size_t splitDepth)
+    {
+        // NOTE : The upper half of the range is split off and queued splitDepth times,
+        //  idle threads steal the oldest (largest) halves first.  The remaining chunks
+        //  are processed in order, an adaptive range splits off the upper half of its
+        //  remaining chunks when threads are idle.  Nothing in this ParallelRange<>
+        //  may be accessed after the last decrement of mIncompleteChunkCount since
+        //  process() may have returned.
+        while (chunkEnd - chunkBegin > 1 && splitDepth) {
+            --splitDepth;
+            auto chunkMid = chunkBegin + (chunkEnd - chunkBegin) / 2;
+            mThreadPool.push_detached(RangeTask(*this, chunkMid, chunkEnd, splitDepth));
+            chunkEnd = chunkMid;
+        }
+        for (auto chunk = chunkBegin; chunk < chunkEnd; ++chunk) {
+            if (mAdaptive && chunkEnd - chunk > 1 && is_thread_idle()) {
+                auto chunkMid = chunk + (chunkEnd - chunk) / 2;
+                mThreadPool.push_detached(RangeTask(*this, chunkMid, chunkEnd, 0));
+                chunkEnd = chunkMid;
+            }
+            try {
+                auto begin = (IndexType)(mBegin + (IndexType)(chunk * (size_t)mGrainSize));
+                auto end = (IndexType)(mEnd - begin > mGrainSize ? begin + mGrainSize : mEnd);
+                mChunkFunction(chunk, begin, end);
+            } catch (...) {
+                if (!mExceptionCaptured.test_and_set()) {
+                    mException = std::current_exception();
+                }
+            }
+        }
+        release(chunkEnd - chunkBegin);
+    }
+
+    inline bool is_thread_idle() const
+    {
+        return !mThreadPool.get_task_count() && mThreadPool.get_active_thread_count() < mThreadPool.get_thread_count();
+    }
+
+    inline void release(size_t chunkCount)
+    {
+        auto& threadPool = mThreadPool;
+        if (mIncompleteChunkCount.fetch_sub(chunkCount, std::memory_order_acq_rel) == chunkCount) {
+            threadPool.notify_waiters();
+        }
+    }
+
+    ThreadPool& mThreadPool;
+    IndexType mBegin { };
+    IndexType mEnd { };
+    IndexType mGrainSize { };
+    size_t mChunkCount { 0 };
+    size_t mInitialSplitDepth { (size_t)-1 };
+    bool mAdaptive { false };
+    std::atomic_size_t mIncompleteChunkCount { 0 };
+    ChunkFunctionType& mChunkFunction;
+    std::exception_ptr mException;
+    std::atomic_flag mExceptionCaptured = ATOMIC_FLAG_INIT;
+};
+
+} // namespace detail
+
+/**
+Calls a given function for each index in a specified range on a given ThreadPool
+@param <IndexType> The type of index used to traverse the range
+@param <FunctionType> The type of function to call
+@param [in] threadPool The ThreadPool to process the range on
+@param [in] begin The beginning of the range
+@param [in] end The end of the range
+@param [in] grainSize The number of indices processed by each task, 0 to split adaptively
+@param [in] function The function to call
+    @note FunctionType must have a signature compatible with void(IndexType) or void(IndexType begin, IndexType end), the latter is called once per chunk
+    @note With an explicit grainSize the range is split recursively down to single chunks, idle threads steal the largest unprocessed halves
+    @note With a grainSize of 0 the range is split into one piece per thread (counting the calling thread), a piece is split further when it's stolen by another thread or when threads are idle, so uneven iterations are balanced without queueing a task per chunk
+    @note The calling thread processes chunks and pending tasks until the range is complete, this function may be called from the given ThreadPool object's threads
+    @note If any call throws, the first exception thrown is rethrown after the range is complete
+    @note If ThreadPool::clear() drops part of the range, that part isn't processed and this function still returns
+*/
+template <typename IndexType, typename FunctionType>
+inline void parallel_for(ThreadPool& threadPool, IndexType begin, IndexType end, IndexType grainSize, FunctionType function)
+{
+    if (begin < end) {
+        auto chunkFunction = [&](size_t, IndexType chunkBegin, IndexType chunkEnd)
+        {
+            if constexpr (std::is_invocable<FunctionType&, IndexType, IndexType>::value) {
+                function(chunkBegin, chunkEnd);
+            } else {
+                for (auto i = chunkBegin; i < chunkEnd; ++i) {
+                    function(i);
+                }
+            }
+        };
+        detail::ParallelRange<IndexType, decltype(chunkFunction)> range(threadPool, begin, end, grainSize, chunkFunction);
+        range.process();
+    }
+}
+
+/**
+Reduces the values produced by a given function for each index in a specified range on a given ThreadPool
+@param <IndexType> The type of index used to traverse the range
+@param <T> The type of value to reduce
+@param <FunctionType> The type of function producing values to reduce
+@param <ReduceFunctionType> The type of function used to combine values
+@param [in] threadPool The ThreadPool to process the range on
+@param [in] begin The beginning of the range
+@param [in] end The end of the range
+@param [in] grainSize The number of indices processed by each task, 0 to split adaptively
+@param [in] identity The identity value of the reduction, each chunk's reduction starts with this value
+@param [in] function The function producing values to reduce
+@param [in] reduceFunction The function used to combine values
+@return The reduced value
+    @note FunctionType must have a signature compatible with T(IndexType)
+    @note grainSize splits the range the same way as parallel_for()
+    @note ReduceFunctionType must have a signature compatible with T(T, T) and must be associative
+    @note Chunk results are combined on the calling thread in index order, so reduceFunction doesn't need to be commutative
+    @note The calling thread processes chunks and pending tasks until the range is complete, this function may be called from the given ThreadPool object's threads
+    @note If any call throws, the first exception thrown is rethrown after the range is complete
+    @note If ThreadPool::clear() drops part of the range, that part's chunks contribute identity and this function still returns
+*/
+template <typename IndexType, typename T, typename FunctionType, typename ReduceFunctionType>
+inline T parallel_reduce(ThreadPool& threadPool, IndexType begin, IndexType end, IndexType grainSize, T identity, FunctionType function, ReduceFunctionType reduceFunction)
+{
+    auto result = identity;
+    if (begin < end) {
+        // NOTE : Chunk results are wrapped so that T = bool doesn't select std::vector<bool>,
+        //  which can't be written concurrently.
+        struct ChunkResult final
+        {
+            T value;
+        };
+        std::vector<ChunkResult> chunkResults;
+        auto chunkFunction = [&](size_t chunkIndex, IndexType chunkBegin, IndexType chunkEnd)
+        {
+            auto chunkResult = identity;
+            for (auto i = chunkBegin; i < chunkEnd; ++i) {
+                chunkResult = reduceFunction(std::move(chunkResult), function(i));
+            }
+            chunkResults[chunkIndex].value = std::move(chunkResult);
+        };
+        detail::ParallelRange<IndexType, decltype(chunkFunction)> range(threadPool, begin, end, grainSize, chunkFunction);
+        chunkResults.resize(range.get_chunk_count(), ChunkResult { identity });
+        range.process();
+        for (auto& chunkResult : chunkResults) {
+            result = reduceFunction(std::move(result), std::move(chunkResult.value));
+        }
+    }
+    return result;
+}
+
+} // namespace dst
@@ -0,0 +1,534 @@
+/*
+==========================================
+  Copyright (c) 2020 Dynamic_Static
+    Patrick Purcell
+      Licensed under the MIT license
+    http://opensource.org/licenses/MIT
+==========================================
+*/
+
+#pragma once
+
+#include "dynamic_static/core/defines.hpp"
+#include "dynamic_static/core/delegate-base.hpp"
+#include "dynamic_static/core/span.hpp"
+#include "dynamic_static/core/subscribable.hpp"
+
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace dst {
+namespace detail {
+
+/**
+Gets a value indicating whether or not a combiner provides bool is_full() const
+@param <CombinerType> The type of combiner to check
+*/
+template <typename CombinerType, typename = void>
+struct CombinerHasIsFull final
+    : std::false_type
+{
+};
+
+/**
+Gets a value indicating whether or not a combiner provides bool is_full() const
+@param <CombinerType> The type of combiner to check
+*/
+template <typename CombinerType>
+struct CombinerHasIsFull<CombinerType, std::void_t<decltype(std::declval<const CombinerType&>().is_full())>> final
+    : std::true_type
+{
+};
+
+} // namespace detail
+
+/**
+Combiner that sums the values returned by a Signal<> object's Action<> objects
+@param <T> The type of value to sum
+*/
+template <typename T>
+class SumCombiner final
+{
+public:
+    /**
+    Constructs an instance of SumCombiner<>
+    @param [in] value (optional = T { }) The initial value of the sum
+    */
+    inline SumCombiner(T value = T { })
+        : mValue { std::move(value) }
+    {
+    }
+
+    /**
+    Adds a value to this SumCombiner<>
+    @param [in] value The value to add
+    @return Whether or not to continue calling Action<> objects, always true
+    */
+    inline bool operator()(T value)
+    {
+        mValue += std::move(value);
+        return true;
+    }
+
+    /**
+    Gets the sum of the values added to this SumCombiner<>
+    @return The sum of the values added to this SumCombiner<>
+    */
+    inline T get_result() const
+    {
+        return mValue;
+    }
+
+private:
+    T mValue { };
+};
+
+/**
+Combiner that finds the smallest value returned by a Signal<> object's Action<> objects
+@param <T> The type of value to compare
+*/
+template <typename T>
+class MinCombiner final
+{
+public:
+    /**
+    Compares a value with the smallest value added to this MinCombiner<>
+    @param [in] value The value to compare
+    @return Whether or not to continue calling Action<> objects, always true
+    */
+    inline bool operator()(T value)
+    {
+        if (!mValue || value < *mValue) {
+            mValue = std::move(value);
+        }
+        return true;
+    }
+
+    /**
+    Gets the smallest value added to this MinCombiner<>
+    @return The smallest value added to this MinCombiner<>, or an empty std::optional<> if no values were added
+    */
+    inline const std::optional<T>& get_result() const
+    {
+        return mValue;
+    }
+
+private:
+    std::optional<T> mValue;
+};
+
+/**
+Combiner that finds the largest value returned by a Signal<> object's Action<> objects
+@param <T> The type of value to compare
+*/
+template <typename T>
+class MaxCombiner final
+{
+public:
+    /**
+    Compares a value with the largest value added to this MaxCombiner<>
+    @param [in] value The value to compare
+    @return Whether or not to continue calling Action<> objects, always true
+    */
+    inline bool operator()(T value)
+    {
+        if (!mValue || *mValue < value) {
+            mValue = std::move(value);
+        }
+        return true;
+    }
+
+    /**
+    Gets the largest value added to this MaxCombiner<>
+    @return The largest value added to this MaxCombiner<>, or an empty std::optional<> if no values were added
+    */
+    inline const std::optional<T>& get_result() const
+    {
+        return mValue;
+    }
+
+private:
+    std::optional<T> mValue;
+};
+
+/**
+Combiner that checks whether any value returned by a Signal<> object's Action<> objects is true
+    @note Action<> objects aren't called after one returns true
+*/
+class AnyCombiner final
+{
+public:
+    /**
+    Checks a value
+    @param [in] value The value to check
+    @return Whether or not to continue calling Action<> objects, false once a value is true
+    */
+    inline bool operator()(bool value)
+    {
+        mValue = value;
+        return !mValue;
+    }
+
+    /**
+    Gets a value indicating whether or not any value checked by this AnyCombiner was true
+    @return Whether or not any value checked by this AnyCombiner was true
+    */
+    inline bool get_result() const
+    {
+        return mValue;
+    }
+
+private:
+    bool mValue { false };
+};
+
+/**
+Combiner that checks whether all values returned by a Signal<> object's Action<> objects are true
+    @note Action<> objects aren't called after one returns false
+*/
+class AllCombiner final
+{
+public:
+    /**
+    Checks a value
+    @param [in] value The value to check
+    @return Whether or not to continue calling Action<> objects, false once a value is false
+    */
+    inline bool operator()(bool value)
+    {
+        mValue = value;
+        return mValue;
+    }
+
+    /**
+    Gets a value indicating whether or not all values checked by this AllCombiner were true
+    @return Whether or not all values checked by this AllCombiner were true, true if no values were checked
+    */
+    inline bool get_result() const
+    {
+        return mValue;
+    }
+
+private:
+    bool mValue { true };
+};
+
+/**
+Combiner that finds the first value returned by a Signal<> object's Action<> objects that converts to true
+@param <T> The type of value to find, ie. a pointer, std::shared_ptr<>, or std::optional<>
+    @note Action<> objects aren't called after one returns a value that converts to true
+*/
+template <typename T>
+class FirstNonNullCombiner final
+{
+public:
+    /**
+    Checks a value
+    @param [in] value The value to check
+    @return Whether or not to continue calling Action<> objects, false once a value converts to true
+    */
+    inline bool operator()(T value)
+    {
+        if (value) {
+            mValue = std::move(value);
+            return false;
+        }
+        return true;
+    }
+
+    /**
+    Gets the first value checked by this FirstNonNullCombiner<> that converted to true
+    @return The first value checked by this FirstNonNullCombiner<> that converted to true, or T { } if no value converted to true
+    */
+    inline const T& get_result() const
+    {
+        return mValue;
+    }
+
+private:
+    T mValue { };
+};
+
+/**
+Combiner that writes the values returned by a Signal<> object's Action<> objects to caller provided storage
+@param <T> The type of value to write
+    @note Action<> objects aren't called after the caller provided storage is full
+*/
+template <typename T>
+class CollectCombiner final
+{
+public:
+    /**
+    Constructs an instance of CollectCombiner<>
+    @param [in] values The storage to write values to
+    */
+    inline CollectCombiner(Span<T> values)
+        : mValues { values }
+    {
+    }
+
+    /**
+    Writes a value
+    @param [in] value The value to write
+    @return Whether or not to continue calling Action<> objects, false once the caller provided storage is full
+    */
+    inline bool operator()(T value)
+    {
+        if (mCount < mValues.size()) {
+            mValues[mCount++] = std::move(value);
+        }
+        return mCount < mValues.size();
+    }
+
+    /**
+    Gets a value indicating whether or not the caller provided storage is full
+    @return Whether or not the caller provided storage is full, true if it's empty
+    */
+    inline bool is_full() const
+    {
+        return mValues.size() <= mCount;
+    }
+
+    /**
+    Gets the number of values written by this CollectCombiner<>
+    @return The number of values written by this CollectCombiner<>
+    */
+    inline size_t get_result() const
+    {
+        return mCount;
+    }
+
+private:
+    Span<T> mValues { nullptr };
+    size_t mCount { 0 };
+};
+
+/**
+Encapsulates a Subscribable multicast Action<> whose return values are combined by a caller provided combiner
+@param <SignatureType> The signature of this Signal<> object's Action<>
+*/
+template <typename SignatureType>
+class Signal;
+
+/**
+Encapsulates a Subscribable multicast Action<> whose return values are combined by a caller provided combiner
+@param <ReturnType> The return type of this Signal<> object's Action<>
+@param <...Args> The argument types of this Signal<> object's Action<>
+    @note A Signal<> object's Action<> is stored in an InlineFunction<> so assigning it never allocates, Action<> types larger than Capacity are rejected at compile time
+    @note Signal<> uses the same Capacity as Delegate<>, define DYNAMIC_STATIC_DELEGATE_CAPACITY before including this file to change it
+    @note Enable the DST_CORE_EVENT_PROFILING CMake option to record calls with EventProfiler, see EventProfiler for details
+    @note Calling a Signal<> walks a cached list of the Action<> objects of it and its subscribed Signal<> objects (recursively), the list is rebuilt on the next call after a Signal<> it includes changes its Action<> or subscribers
+*/
+template <typename ReturnType, typename ...Args>
+class Signal<ReturnType(Args...)>
+    : private detail::DelegateBase<ReturnType(Args...)>
+{
+public:
+    static_assert(!std::is_void<ReturnType>::value, "Signal<> ReturnType must not be void, use Delegate<> for Action<> objects that don't return a value");
+
+    /**
+    The size in bytes of the inline buffer used to store a Signal<> object's Action<>
+    */
+    static constexpr size_t Capacity { detail::DelegateBase<ReturnType(Args...)>::Capacity };
+
+    /**
+    Constructs an instance of Signal<>
+    */
+    Signal() = default;
+
+    /**
+    Constructs an instance of Signal<>
+    @param <ActionType> The type of object to assign to this Signal<> object's Action<>
+    @param [in] action This Signal<> object's Action<>
+        @note ActionType must have a signautre compatible with this Signal<> object's SignatureType parameter
+        @note ActionType must fit in Capacity and be nothrow move constructible
+        @note Passing nullptr for action will clear this Signal<> object's Action<>
+    */
+    template <typename ActionType>
+    inline Signal(ActionType action)
+        : detail::DelegateBase<ReturnType(Args...)>(std::move(action))
+    {
+    }
+
+    /**
+    Assigns this Signal<> object's Action<>
+    @param <ActionType> The type of object to assign to this Signal<> object's Action<>
+    @param [in] action This Signal<> object's Action<>
+    @return A reference to this Signal<>
+        @note ActionType must have a signautre compatible with this Signal<> object's SignatureType parameter
+        @note ActionType must fit in Capacity and be nothrow move constructible
+        @note Passing nullptr for action will clear this Signal<> object's Action<>
+    */
+    template <typename ActionType>
+    inline Signal<ReturnType(Args...)>& operator=(ActionType action)
+    {
+        this->set_action(std::move(action));
+        return *this;
+    }
+
+    /**
+    Assigns this Signal<> object's Action<> to call a specified member function on a specified object
+    @param <Method> The member function to call
+    @param <T> The type of object to call the member function on
+    @param [in] object The object to call the member function on
+    @return A reference to this Signal<>
+        @note Only a pointer to the given object is stored, the object must outlive this Signal<> object's Action<>
+    */
+    template <auto Method, typename T>
+    inline Signal<ReturnType(Args...)>& bind(T& object)
+    {
+        this->template bind_action<Method>(object);
+        return *this;
+    }
+
+    /**
+    Moves an instance of Signal<>
+    @param [in] other The Signal<> to move from
+    */
+    inline Signal(Signal<ReturnType(Args...)>&& other) noexcept
+    {
+        *this = std::move(other);
+    }
+
+    /**
+    Moves an instance of Signal<>
+    @param [in] other The Signal<> to move from
+    @return A reference to this Signal<>
+    */
+    inline Signal<ReturnType(Args...)>& operator=(Signal<ReturnType(Args...)>&& other) noexcept
+    {
+        detail::DelegateBase<ReturnType(Args...)>::operator=(std::move(other));
+        return *this;
+    }
+
+    /**
+    Adds a subscriber to this Signal<>
+    @param [in] subscriber The Signal<> subscribing to this Signal<>
+    @return A reference to this Signal<>
+        @note This method is a noop if it would cause a duplicate subscription
+        @note This method is a noop if it would cause a self subscription
+    */
+    inline Signal<ReturnType(Args...)>& operator+=(Signal<ReturnType(Args...)>& subscriber)
+    {
+        Subscribable::operator+=(subscriber);
+        return *this;
+    }
+
+    /**
+    Removes a subscriber from this Signal<>
+    @param [in] subscriber The Signal<> unsubscribing from this Signal<>
+    @return A reference to this Signal<>
+        @note This method is a noop if the given Signal<> is not subscribed to this Signal<>
+        @note Finding the given Signal<> is linear in this Signal<> object's number of subscribers, use subscribe() to get a Subscription that's removed in O(1)
+    */
+    inline Signal<ReturnType(Args...)>& operator-=(Signal<ReturnType(Args...)>& subscriber)
+    {
+        Subscribable::operator-=(subscriber);
+        return *this;
+    }
+
+    /**
+    Adds a subscriber to this Signal<> and gets a Subscription that removes it
+    @param [in] subscriber The Signal<> subscribing to this Signal<>
+    @return A Subscription that removes the subscription when it's destroyed or reset, or an empty Subscription if this method is a noop
+        @note This method is a noop if it would cause a duplicate subscription
+        @note This method is a noop if it would cause a self subscription
+    */
+    inline Subscription subscribe(Signal<ReturnType(Args...)>& subscriber)
+    {
+        return Subscribable::subscribe(subscriber);
+    }
+
+    /**
+    Calls this Signal<> object's Action<> and that of all subscribed Signal<> objects (recursively) with the given arguments, discarding returned values
+    @param [in] args The arguments to call this Signal<> object's Action<> and all subscribed Signal<> objects (recursively) with
+        @note The same ordering and restrictions as invoke() apply
+    */
+    inline void operator()(Args&&... args) const
+    {
+        this->for_each_action(
+            [&](const auto& action)
+            {
+                action(std::forward<Args>(args)...);
+                return true;
+            }
+        );
+    }
+
+    /**
+    Calls this Signal<> object's Action<> and that of all subscribed Signal<> objects (recursively) with the given arguments, passing returned values to a given combiner
+    @param <CombinerType> The type of combiner to pass returned values to
+    @param [in] combiner The combiner to pass returned values to
+    @param [in] args The arguments to call this Signal<> object's Action<> and all subscribed Signal<> objects (recursively) with
+    @return The value returned by the given combiner object's get_result() method
+        @note CombinerType must provide bool operator()(ReturnType) that returns whether or not to continue calling Action<> objects, and get_result()
+        @note CombinerType may provide bool is_full() const, it's checked before each Action<> is called so a combiner that can't accept any values doesn't call any Action<> objects
+        @note Action<> objects aren't called after the given combiner returns false
+        @note Subscribed Signal<> objects are called in the order they were subscribed in, depth first
+        @note Each Signal<> is called once per call even if it's reachable through more than one subscription, subscription cycles are allowed
+        @note This Signal<> object and subscribed Signal<> objects (recursively) must not add or remove subscribers, std::move(), or be destroyed during the scope of this method
+        @note Exceptions thrown by Action<> objects will call std::terminate()
+        @note This Signal<> may be called from multiple threads at once, the first call after a change rebuilds the cached list of Action<> objects while concurrent calls build a temporary list
+    */
+    template <typename CombinerType>
+    inline auto invoke(CombinerType&& combiner, Args&&... args) const
+    {
+        this->for_each_action(
+            [&](const auto& action)
+            {
+                if constexpr (detail::CombinerHasIsFull<std::decay_t<CombinerType>>::value) {
+                    if (combiner.is_full()) {
+                        return false;
+                    }
+                }
+                return combiner(action(std::forward<Args>(args)...));
+            }
+        );
+        return combiner.get_result();
+    }
+
+    /**
+    Removes all subscribers from this Signal<>
+    */
+    inline void clear_subscribers()
+    {
+        Subscribable::clear_subscribers();
+    }
+
+    /**
+    Removes all subscriptions to this Signal<>
+    */
+    inline void clear_subscriptions()
+    {
+        Subscribable::clear_subscriptions();
+    }
+
+    /**
+    Clears this Signal<> object's Action<> and removes all subscribers from and subscriptions to this Signal<>
+    */
+    inline void clear()
+    {
+        this->clear_action();
+        clear_subscribers();
+        clear_subscriptions();
+    }
+
+    /**
+    Removes all subscribers from and subscriptions to a range of Signal<> objects
+    @param <IteratorType> The type of iterator used to traverse the range
+    @param [in] begin The beginning of the range
+    @param [in] end The end of the range
+        @note See Subscribable::clear() for details
+    */
+    template <typename IteratorType>
+    static inline void clear(IteratorType begin, IteratorType end)
+    {
+        Subscribable::clear(begin, end);
+    }
+
+private:
+    friend class Subscribable;
+};
+
+} // namespace dst
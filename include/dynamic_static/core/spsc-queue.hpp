@@ -0,0 +1,187 @@
+/*
+==========================================
+  Copyright (c) 2020 Dynamic_Static
+    Patrick Purcell
+      Licensed under the MIT license
+    http://opensource.org/licenses/MIT
+==========================================
+*/
+
+#pragma once
+
+#include "dynamic_static/core/defines.hpp"
+
+#include <atomic>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace dst {
+
+/**
+Bounded lock free queue that supports one producer and one consumer
+@param <T> The type of element stored in this SpscQueue<>
+    @note Only one thread may push and only one thread may pop at a time, the producer and consumer may be different threads
+    @note The producer and consumer positions are padded to separate cache lines, each side caches the other side's position and only reloads it when the queue appears full or empty
+    @note T must be nothrow move constructible and nothrow destructible
+*/
+template <typename T>
+class SpscQueue final
+{
+public:
+    /**
+    Constructs an instance of SpscQueue<>
+    @param [in] capacity The minimum number of elements this SpscQueue<> can store
+        @note capacity is rounded up to a power of two, at least 2
+    */
+    inline explicit SpscQueue(size_t capacity)
+    {
+        static_assert(std::is_nothrow_move_constructible<T>::value, "SpscQueue<> T must be nothrow move constructible");
+        static_assert(std::is_nothrow_destructible<T>::value, "SpscQueue<> T must be nothrow destructible");
+        size_t slotCount = 2;
+        while (slotCount < capacity) {
+            slotCount <<= 1;
+        }
+        mMask = slotCount - 1;
+        mupSlots = std::make_unique<Slot[]>(slotCount);
+    }
+
+    /**
+    Destroys this instance of SpscQueue<>
+        @note Elements remaining in this SpscQueue<> are destroyed
+    */
+    inline ~SpscQueue()
+    {
+        auto pushPosition = mPushPosition.load(std::memory_order_relaxed);
+        for (auto position = mPopPosition.load(std::memory_order_relaxed); position != pushPosition; ++position) {
+            get_value(mupSlots[position & mMask])->~T();
+        }
+    }
+
+    /**
+    Gets the number of elements this SpscQueue<> can store
+    @return The number of elements this SpscQueue<> can store
+    */
+    inline size_t capacity() const
+    {
+        return mMask + 1;
+    }
+
+    /**
+    Gets the number of elements in this SpscQueue<>
+    @return The number of elements in this SpscQueue<>
+        @note The value retuned by this method may be stale by the time it's read
+    */
+    inline size_t size() const
+    {
+        auto popPosition = mPopPosition.load(std::memory_order_acquire);
+        auto pushPosition = mPushPosition.load(std::memory_order_acquire);
+        return pushPosition - popPosition;
+    }
+
+    /**
+    Gets a value indicating whether or not this SpscQueue<> is empty
+    @return Whether or not this SpscQueue<> is empty
+        @note The value retuned by this method may be stale by the time it's read
+    */
+    inline bool empty() const
+    {
+        return !size();
+    }
+
+    /**
+    Adds an element to this SpscQueue<> if there's room
+    @param [in] value The element to add
+    @return Whether or not the element was added
+        @note This method must only be called from the producer thread
+    */
+    inline bool try_push(const T& value)
+    {
+        return try_emplace(value);
+    }
+
+    /**
+    Adds an element to this SpscQueue<> if there's room
+    @param [in] value The element to add
+    @return Whether or not the element was added, if the element wasn't added the given value isn't moved from
+        @note This method must only be called from the producer thread
+    */
+    inline bool try_push(T&& value)
+    {
+        return try_emplace(std::move(value));
+    }
+
+    /**
+    Constructs an element in this SpscQueue<> if there's room
+    @param <Args> The types of arguments used to construct the element
+    @param [in] args The arguments used to construct the element
+    @return Whether or not the element was constructed
+        @note This method must only be called from the producer thread
+    */
+    template <typename ...Args>
+    inline bool try_emplace(Args&&... args)
+    {
+        auto position = mPushPosition.load(std::memory_order_relaxed);
+        if (position - mCachedPopPosition > mMask) {
+            mCachedPopPosition = mPopPosition.load(std::memory_order_acquire);
+            if (position - mCachedPopPosition > mMask) {
+                return false;
+            }
+        }
+        new (&mupSlots[position & mMask].storage) T(std::forward<Args>(args)...);
+        mPushPosition.store(position + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+    Removes the oldest element from this SpscQueue<> if there is one
+    @param [out] value The T to move the removed element into
+    @return Whether or not an element was removed
+        @note If moving into the given value throws, the element is still removed and the exception is rethrown
+        @note This method must only be called from the consumer thread
+    */
+    inline bool try_pop(T& value)
+    {
+        auto position = mPopPosition.load(std::memory_order_relaxed);
+        if (position == mCachedPushPosition) {
+            mCachedPushPosition = mPushPosition.load(std::memory_order_acquire);
+            if (position == mCachedPushPosition) {
+                return false;
+            }
+        }
+        auto pValue = get_value(mupSlots[position & mMask]);
+        try {
+            value = std::move(*pValue);
+        } catch (...) {
+            pValue->~T();
+            mPopPosition.store(position + 1, std::memory_order_release);
+            throw;
+        }
+        pValue->~T();
+        mPopPosition.store(position + 1, std::memory_order_release);
+        return true;
+    }
+
+private:
+    struct Slot final
+    {
+        alignas(T) unsigned char storage[sizeof(T)];
+    };
+
+    static inline T* get_value(Slot& slot)
+    {
+        return std::launder(reinterpret_cast<T*>(&slot.storage));
+    }
+
+    std::unique_ptr<Slot[]> mupSlots;
+    size_t mMask { 0 };
+    alignas(64) std::atomic_size_t mPushPosition { 0 };
+    size_t mCachedPopPosition { 0 };
+    alignas(64) std::atomic_size_t mPopPosition { 0 };
+    size_t mCachedPushPosition { 0 };
+    SpscQueue(const SpscQueue&) = delete;
+    SpscQueue& operator=(const SpscQueue&) = delete;
+};
+
+} // namespace dst
@@ -1,4 +1,3 @@
-
 /*
 ==========================================
   Copyright (c) 2011-2020 Dynamic_Static
@@ -12,17 +11,381 @@
 
 #include "dynamic_static/core/defines.hpp"
 
-#include <set>
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <memory>
 #include <utility>
 
 namespace dst {
 
+class Subscribable;
+
+/**
+Scoped handle to a subscription made with Subscribable::subscribe()
+    @note Destroying or resetting a Subscription removes its subscription in O(1)
+    @note A Subscription is weak, it's safe to destroy after its subscription has been removed by other means or after either Subscribable has been moved or destroyed
+*/
+class Subscription final
+{
+public:
+    /**
+    Constructs an instance of Subscription
+    */
+    Subscription() = default;
+
+    /**
+    Moves an instance of Subscription
+    @param [in] other The Subscription to move from
+    */
+    inline Subscription(Subscription&& other) noexcept
+    {
+        *this = std::move(other);
+    }
+
+    /**
+    Destroys this instance of Subscription
+    */
+    inline ~Subscription()
+    {
+        reset();
+    }
+
+    /**
+    Moves an instance of Subscription
+    @param [in] other The Subscription to move from
+    @return A reference to this Subscription
+    */
+    inline Subscription& operator=(Subscription&& other) noexcept
+    {
+        if (this != &other) {
+            reset();
+            mspAnchor = std::move(other.mspAnchor);
+            mSlot = other.mSlot;
+            mGeneration = other.mGeneration;
+        }
+        return *this;
+    }
+
+    /**
+    Gets a value indicating whether or not this Subscription's subscription still exists
+    @return Whether or not this Subscription's subscription still exists
+    */
+    inline bool is_subscribed() const;
+
+    /**
+    Removes this Subscription's subscription and detaches this Subscription
+        @note This method is a noop if this Subscription's subscription has already been removed
+    */
+    inline void reset();
+
+    /**
+    Detaches this Subscription without removing its subscription
+    */
+    inline void release()
+    {
+        mspAnchor.reset();
+    }
+
+private:
+    inline Subscription(std::shared_ptr<Subscribable*> spAnchor, uint32_t slot, uint32_t generation)
+        : mspAnchor { std::move(spAnchor) }
+        , mSlot { slot }
+        , mGeneration { generation }
+    {
+    }
+
+    std::shared_ptr<Subscribable*> mspAnchor;
+    uint32_t mSlot { 0 };
+    uint32_t mGeneration { 0 };
+    friend class Subscribable;
+    Subscription(const Subscription&) = delete;
+    Subscription& operator=(const Subscription&) = delete;
+};
+
 /**
 Encapsulates a collection of mutual references
+    @note Each reference is stored in a slot that records the slot of its mutual reference, so a known subscription is removed from both sides in O(1)
+    @note Subscribers and subscriptions are linked through their slots in the order they were subscribed in, a Subscribable with a few subscribers doesn't allocate
 */
 class Subscribable
 {
+private:
+    static constexpr uint32_t InvalidSlot { std::numeric_limits<uint32_t>::max() };
+
+    struct Slot final
+    {
+        Subscribable* pOther { nullptr };
+        uint32_t otherSlot { InvalidSlot };
+        uint32_t generation { 0 };
+        uint32_t previous { InvalidSlot };
+        uint32_t next { InvalidSlot };
+    };
+
 public:
+    /**
+    The number of subscribers and subscriptions a Subscribable can store without allocating
+    */
+    static constexpr size_t InlineSubscriberCount { 4 };
+
+    /**
+    Collection of a Subscribable object's subscribers or subscriptions
+        @note Iteration visits Subscribable objects in the order they were subscribed in
+    */
+    class Collection final
+    {
+    public:
+        /**
+        Iterates over the Subscribable objects in a Collection
+        */
+        class const_iterator final
+        {
+        public:
+            using iterator_category = std::bidirectional_iterator_tag;
+            using value_type = Subscribable*;
+            using difference_type = std::ptrdiff_t;
+            using pointer = Subscribable* const*;
+            using reference = Subscribable* const&;
+
+            const_iterator() = default;
+
+            inline reference operator*() const
+            {
+                return mpCollection->mpSlots[mSlot].pOther;
+            }
+
+            inline const_iterator& operator++()
+            {
+                mSlot = mpCollection->mpSlots[mSlot].next;
+                return *this;
+            }
+
+            inline const_iterator operator++(int)
+            {
+                auto itr = *this;
+                ++*this;
+                return itr;
+            }
+
+            inline const_iterator& operator--()
+            {
+                mSlot = mSlot != InvalidSlot ? mpCollection->mpSlots[mSlot].previous : mpCollection->mTail;
+                return *this;
+            }
+
+            inline const_iterator operator--(int)
+            {
+                auto itr = *this;
+                --*this;
+                return itr;
+            }
+
+            inline bool operator==(const const_iterator& other) const
+            {
+                return mSlot == other.mSlot;
+            }
+
+            inline bool operator!=(const const_iterator& other) const
+            {
+                return mSlot != other.mSlot;
+            }
+
+        private:
+            inline const_iterator(const Collection* pCollection, uint32_t slot)
+                : mpCollection { pCollection }
+                , mSlot { slot }
+            {
+            }
+
+            const Collection* mpCollection { nullptr };
+            uint32_t mSlot { InvalidSlot };
+            friend class Collection;
+        };
+
+        /**
+        Constructs an instance of Collection
+        */
+        Collection() = default;
+
+        /**
+        Moves an instance of Collection
+        @param [in] other The Collection to move from
+        */
+        inline Collection(Collection&& other) noexcept
+        {
+            *this = std::move(other);
+        }
+
+        /**
+        Moves an instance of Collection
+        @param [in] other The Collection to move from
+        @return A reference to this Collection
+            @note The moved from Collection is left empty
+        */
+        inline Collection& operator=(Collection&& other) noexcept
+        {
+            if (this != &other) {
+                mupHeapSlots = std::move(other.mupHeapSlots);
+                if (mupHeapSlots) {
+                    mpSlots = mupHeapSlots.get();
+                } else {
+                    mInlineSlots = other.mInlineSlots;
+                    mpSlots = mInlineSlots.data();
+                }
+                mCapacity = other.mCapacity;
+                mSlotCount = other.mSlotCount;
+                mHead = other.mHead;
+                mTail = other.mTail;
+                mFree = other.mFree;
+                mSize = other.mSize;
+                other.mInlineSlots = { };
+                other.mpSlots = other.mInlineSlots.data();
+                other.mCapacity = InlineSubscriberCount;
+                other.mSlotCount = 0;
+                other.mHead = InvalidSlot;
+                other.mTail = InvalidSlot;
+                other.mFree = InvalidSlot;
+                other.mSize = 0;
+            }
+            return *this;
+        }
+
+        /**
+        Gets an iterator to the first Subscribable in this Collection
+        @return An iterator to the first Subscribable in this Collection
+        */
+        inline const_iterator begin() const
+        {
+            return const_iterator(this, mHead);
+        }
+
+        /**
+        Gets an iterator one past the last Subscribable in this Collection
+        @return An iterator one past the last Subscribable in this Collection
+        */
+        inline const_iterator end() const
+        {
+            return const_iterator(this, InvalidSlot);
+        }
+
+        /**
+        Gets the number of Subscribable objects in this Collection
+        @return The number of Subscribable objects in this Collection
+        */
+        inline size_t size() const
+        {
+            return mSize;
+        }
+
+        /**
+        Gets a value indicating whether or not this Collection is empty
+        @return Whether or not this Collection is empty
+        */
+        inline bool empty() const
+        {
+            return !mSize;
+        }
+
+        /**
+        Gets the number of times a specified Subscribable is in this Collection
+        @param [in] pSubscribable The Subscribable to count
+        @return 1 if the Subscribable is in this Collection, otherwise 0
+        */
+        inline size_t count(const Subscribable* pSubscribable) const
+        {
+            return find(pSubscribable) != InvalidSlot ? 1 : 0;
+        }
+
+    private:
+        inline uint32_t find(const Subscribable* pSubscribable) const
+        {
+            auto slot = mHead;
+            while (slot != InvalidSlot && mpSlots[slot].pOther != pSubscribable) {
+                slot = mpSlots[slot].next;
+            }
+            return slot;
+        }
+
+        inline uint32_t insert(Subscribable* pOther)
+        {
+            auto slot = mFree;
+            if (slot != InvalidSlot) {
+                mFree = mpSlots[slot].next;
+            } else {
+                if (mSlotCount == mCapacity) {
+                    grow();
+                }
+                slot = mSlotCount++;
+            }
+            auto& newSlot = mpSlots[slot];
+            newSlot.pOther = pOther;
+            newSlot.previous = mTail;
+            newSlot.next = InvalidSlot;
+            if (mTail != InvalidSlot) {
+                mpSlots[mTail].next = slot;
+            } else {
+                mHead = slot;
+            }
+            mTail = slot;
+            ++mSize;
+            return slot;
+        }
+
+        inline void erase(uint32_t slot)
+        {
+            auto& erasedSlot = mpSlots[slot];
+            if (erasedSlot.previous != InvalidSlot) {
+                mpSlots[erasedSlot.previous].next = erasedSlot.next;
+            } else {
+                mHead = erasedSlot.next;
+            }
+            if (erasedSlot.next != InvalidSlot) {
+                mpSlots[erasedSlot.next].previous = erasedSlot.previous;
+            } else {
+                mTail = erasedSlot.previous;
+            }
+            erasedSlot.pOther = nullptr;
+            erasedSlot.otherSlot = InvalidSlot;
+            erasedSlot.previous = InvalidSlot;
+            erasedSlot.next = mFree;
+            ++erasedSlot.generation;
+            mFree = slot;
+            --mSize;
+        }
+
+        inline void erase_all()
+        {
+            while (mHead != InvalidSlot) {
+                erase(mHead);
+            }
+        }
+
+        inline void grow()
+        {
+            auto capacity = mCapacity * 2;
+            auto upHeapSlots = std::make_unique<Slot[]>(capacity);
+            std::copy(mpSlots, mpSlots + mSlotCount, upHeapSlots.get());
+            mupHeapSlots = std::move(upHeapSlots);
+            mpSlots = mupHeapSlots.get();
+            mCapacity = capacity;
+        }
+
+        std::array<Slot, InlineSubscriberCount> mInlineSlots { };
+        std::unique_ptr<Slot[]> mupHeapSlots;
+        Slot* mpSlots { mInlineSlots.data() };
+        uint32_t mCapacity { InlineSubscriberCount };
+        uint32_t mSlotCount { 0 };
+        uint32_t mHead { InvalidSlot };
+        uint32_t mTail { InvalidSlot };
+        uint32_t mFree { InvalidSlot };
+        size_t mSize { 0 };
+        friend class Subscribable;
+        Collection(const Collection&) = delete;
+        Collection& operator=(const Collection&) = delete;
+    };
+
     /**
     Constructs an instance of Subscribable
     */
@@ -42,6 +405,9 @@ public:
     */
     inline virtual ~Subscribable()
     {
+        if (mspAnchor) {
+            *mspAnchor = nullptr;
+        }
         clear();
     }
 
@@ -49,18 +415,36 @@ public:
     Moves an instance of Subscribable
     @param [in] other The Subscribable to move from
     @return A reference to this Subscribable
+        @note This Subscribable object's existing subscribers and subscriptions are removed
+        @note Subscription objects for the given Subscribable object's subscribers remain valid
     */
     inline Subscribable& operator=(Subscribable&& other) noexcept
     {
-        mSubscribers = std::move(other.mSubscribers);
-        for (auto pSubscriber : mSubscribers) {
-            pSubscriber->mSubscriptions.erase(&other);
-            pSubscriber->mSubscriptions.insert(this);
-        }
-        mSubscriptions = std::move(other.mSubscriptions);
-        for (auto pSubscription : mSubscriptions) {
-            pSubscription->mSubscribers.erase(&other);
-            pSubscription->mSubscribers.insert(this);
+        if (this != &other) {
+            // NOTE : Slots are moved along with their Collection so the mutual references
+            //  in other Subscribable objects are patched in place, keeping the order
+            //  that other was subscribed in.
+            clear();
+            if (mspAnchor) {
+                *mspAnchor = nullptr;
+            }
+            mspAnchor = std::move(other.mspAnchor);
+            if (mspAnchor) {
+                *mspAnchor = this;
+            }
+            mSubscribers = std::move(other.mSubscribers);
+            for (auto slot = mSubscribers.mHead; slot != InvalidSlot; slot = mSubscribers.mpSlots[slot].next) {
+                const auto& subscriberSlot = mSubscribers.mpSlots[slot];
+                subscriberSlot.pOther->mSubscriptions.mpSlots[subscriberSlot.otherSlot].pOther = this;
+            }
+            mSubscriptions = std::move(other.mSubscriptions);
+            for (auto slot = mSubscriptions.mHead; slot != InvalidSlot; slot = mSubscriptions.mpSlots[slot].next) {
+                const auto& subscriptionSlot = mSubscriptions.mpSlots[slot];
+                subscriptionSlot.pOther->mSubscribers.mpSlots[subscriptionSlot.otherSlot].pOther = this;
+                subscriptionSlot.pOther->on_subscribers_changed();
+            }
+            on_subscribers_changed();
+            other.on_subscribers_changed();
         }
         return *this;
     }
@@ -74,10 +458,7 @@ public:
     */
     inline Subscribable& operator+=(Subscribable& subscriber)
     {
-        if (this != &subscriber) {
-            mSubscribers.insert(&subscriber);
-            subscriber.mSubscriptions.insert(this);
-        }
+        link(subscriber);
         return *this;
     }
 
@@ -86,21 +467,43 @@ public:
     @param [in] subscriber The Subscribable unsubscribing from this Subscribable
     @return A reference to this Subscribable
         @note This method is a noop if the given Subscribable is not subscribed to this Subscribable
+        @note Finding the subscription is linear in this Subscribable object's number of subscribers or the given Subscribable object's number of subscriptions, whichever is smaller, use subscribe() to get a Subscription that's removed in O(1)
     */
     inline Subscribable& operator-=(Subscribable& subscriber)
     {
-        subscriber.mSubscriptions.erase(this);
-        mSubscribers.erase(&subscriber);
+        auto slot = find_subscriber(subscriber);
+        if (slot != InvalidSlot) {
+            unlink(slot);
+        }
         return *this;
     }
 
+    /**
+    Adds a subscriber to this Subscribable and gets a Subscription that removes it
+    @param [in] subscriber The Subscribable subscribing to this Subscribable
+    @return A Subscription that removes the subscription when it's destroyed or reset, or an empty Subscription if this method is a noop
+        @note This method is a noop if it would cause a duplicate subscription
+        @note This method is a noop if it would cause a self subscription
+    */
+    inline Subscription subscribe(Subscribable& subscriber)
+    {
+        auto slot = link(subscriber);
+        if (slot == InvalidSlot) {
+            return { };
+        }
+        if (!mspAnchor) {
+            mspAnchor = std::make_shared<Subscribable*>(this);
+        }
+        return Subscription(mspAnchor, slot, mSubscribers.mpSlots[slot].generation);
+    }
+
     /**
     Gets this Subscribable subscribers
     @return This Subscribable object's subscribers
         @note Adding or removing sbuscribers invalidates the returned collection's iterators
-        @note The order of subscribers is nondeterministic; ie. it is not the order they were subscribed in
+        @note Subscribers are in the order they were subscribed in
     */
-    inline const std::set<Subscribable*>& get_subscribers() const
+    inline const Collection& get_subscribers() const
     {
         return mSubscribers;
     }
@@ -109,9 +512,9 @@ public:
     Gets this Subscribable subscriptions
     @return This Subscribable object's subscriptions
         @note Adding or removing subscriptions invalidates the returned collection's iterators
-        @note The order of subscriptions is nondeterministic; ie it is not the order they were subscribed in
+        @note Subscriptions are in the order they were subscribed in
     */
-    inline const std::set<Subscribable*>& get_subscriptions() const
+    inline const Collection& get_subscriptions() const
     {
         return mSubscriptions;
     }
@@ -121,10 +524,9 @@ public:
     */
     inline void clear_subscribers()
     {
-        for (auto pSubscriber : mSubscribers) {
-            pSubscriber->mSubscriptions.erase(this);
+        while (mSubscribers.mHead != InvalidSlot) {
+            unlink(mSubscribers.mHead);
         }
-        mSubscribers.clear();
     }
 
     /**
@@ -132,10 +534,10 @@ public:
     */
     inline void clear_subscriptions()
     {
-        for (auto pSubscription : mSubscriptions) {
-            pSubscription->mSubscribers.erase(this);
+        while (mSubscriptions.mHead != InvalidSlot) {
+            const auto& subscriptionSlot = mSubscriptions.mpSlots[mSubscriptions.mHead];
+            subscriptionSlot.pOther->unlink(subscriptionSlot.otherSlot);
         }
-        mSubscriptions.clear();
     }
 
     /**
@@ -147,11 +549,114 @@ public:
         clear_subscriptions();
     }
 
+    /**
+    Removes all subscribers from and subscriptions to a range of Subscribable objects
+    @param <IteratorType> The type of iterator used to traverse the range
+    @param [in] begin The beginning of the range
+    @param [in] end The end of the range
+        @note Mutual references between Subscribable objects in the range are dropped without being removed from each other one at a time, use this method to tear down groups of Subscribable objects that are being destroyed together
+        @note Mutual references with Subscribable objects outside of the range are removed from both sides
+        @note The range's elements must be Subscribable objects or types derived from Subscribable, types that derive from Subscribable privately must befriend Subscribable
+    */
+    template <typename IteratorType>
+    static inline void clear(IteratorType begin, IteratorType end)
+    {
+        for (auto itr = begin; itr != end; ++itr) {
+            static_cast<Subscribable&>(*itr).mClearing = true;
+        }
+        for (auto itr = begin; itr != end; ++itr) {
+            auto& subscribable = static_cast<Subscribable&>(*itr);
+            for (auto pCollection : { &subscribable.mSubscribers, &subscribable.mSubscriptions }) {
+                auto pOtherCollection = pCollection == &subscribable.mSubscribers ? &Subscribable::mSubscriptions : &Subscribable::mSubscribers;
+                for (auto slot = pCollection->mHead; slot != InvalidSlot; slot = pCollection->mpSlots[slot].next) {
+                    const auto& linkSlot = pCollection->mpSlots[slot];
+                    if (!linkSlot.pOther->mClearing) {
+                        (linkSlot.pOther->*pOtherCollection).erase(linkSlot.otherSlot);
+                        if (pOtherCollection == &Subscribable::mSubscribers) {
+                            linkSlot.pOther->on_subscribers_changed();
+                        }
+                    }
+                }
+                pCollection->erase_all();
+            }
+        }
+        for (auto itr = begin; itr != end; ++itr) {
+            auto& subscribable = static_cast<Subscribable&>(*itr);
+            subscribable.mClearing = false;
+            subscribable.on_subscribers_changed();
+        }
+    }
+
 private:
-    std::set<Subscribable*> mSubscribers;
-    std::set<Subscribable*> mSubscriptions;
+    /**
+    Called when this Subscribable object's subscribers change
+        @note This method isn't called when only this Subscribable object's subscriptions change
+    */
+    inline virtual void on_subscribers_changed()
+    {
+    }
+
+    inline uint32_t find_subscriber(const Subscribable& subscriber) const
+    {
+        // NOTE : Either side of a subscription can be searched, the smaller side is
+        //  searched so that subscribing many Subscribable objects with a few
+        //  subscriptions each to a single Subscribable stays cheap.
+        if (mSubscribers.size() <= subscriber.mSubscriptions.size()) {
+            return mSubscribers.find(&subscriber);
+        }
+        auto slot = subscriber.mSubscriptions.find(this);
+        return slot != InvalidSlot ? subscriber.mSubscriptions.mpSlots[slot].otherSlot : InvalidSlot;
+    }
+
+    inline uint32_t link(Subscribable& subscriber)
+    {
+        if (this == &subscriber || find_subscriber(subscriber) != InvalidSlot) {
+            return InvalidSlot;
+        }
+        auto subscriberSlot = mSubscribers.insert(&subscriber);
+        auto subscriptionSlot = subscriber.mSubscriptions.insert(this);
+        mSubscribers.mpSlots[subscriberSlot].otherSlot = subscriptionSlot;
+        subscriber.mSubscriptions.mpSlots[subscriptionSlot].otherSlot = subscriberSlot;
+        on_subscribers_changed();
+        return subscriberSlot;
+    }
+
+    inline void unlink(uint32_t subscriberSlot)
+    {
+        auto pSubscriber = mSubscribers.mpSlots[subscriberSlot].pOther;
+        pSubscriber->mSubscriptions.erase(mSubscribers.mpSlots[subscriberSlot].otherSlot);
+        mSubscribers.erase(subscriberSlot);
+        on_subscribers_changed();
+    }
+
+    inline bool is_linked(uint32_t subscriberSlot, uint32_t generation) const
+    {
+        return
+            subscriberSlot < mSubscribers.mSlotCount &&
+            mSubscribers.mpSlots[subscriberSlot].pOther &&
+            mSubscribers.mpSlots[subscriberSlot].generation == generation;
+    }
+
+    Collection mSubscribers;
+    Collection mSubscriptions;
+    std::shared_ptr<Subscribable*> mspAnchor;
+    bool mClearing { false };
+    friend class Subscription;
     Subscribable(const Subscribable&) = delete;
     Subscribable& operator=(const Subscribable&) = delete;
 };
 
+inline bool Subscription::is_subscribed() const
+{
+    return mspAnchor && *mspAnchor && (*mspAnchor)->is_linked(mSlot, mGeneration);
+}
+
+inline void Subscription::reset()
+{
+    if (is_subscribed()) {
+        (*mspAnchor)->unlink(mSlot);
+    }
+    mspAnchor.reset();
+}
+
 } // namespace dst
@@ -0,0 +1,259 @@
+/*
+==========================================
+  Copyright (c) 2020 Dynamic_Static
+    Patrick Purcell
+      Licensed under the MIT license
+    http://opensource.org/licenses/MIT
+==========================================
+*/
+
+#pragma once
+
+#include "dynamic_static/core/action.hpp"
+#include "dynamic_static/core/defines.hpp"
+#include "dynamic_static/core/thread-pool.hpp"
+
+#include <atomic>
+#include <cassert>
+#include <exception>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace dst {
+
+/**
+Encapsulates a directed acyclic graph of tasks that can be processed repeatedly on a ThreadPool
+    @note Tasks and dependencies are recorded once, each call to run() processes every task after all of its predecessors have completed
+    @note Tasks are released by atomic dependency counters as soon as their last predecessor completes, no ThreadPool thread blocks waiting on a predecessor
+*/
+class TaskGraph final
+{
+public:
+    /**
+    Constructs an instance of TaskGraph
+    */
+    TaskGraph() = default;
+
+    /**
+    Adds a task to this TaskGraph
+    @param <TaskType> The type of task to add
+    @param [in] task The task to add
+    @return The index of the added task, used to add dependencies
+        @note TaskType must have a signature compatible with void()
+        @note This method must not be called while this TaskGraph is running
+    */
+    template <typename TaskType>
+    inline size_t add_task(TaskType task)
+    {
+        mNodes.emplace_back();
+        mNodes.back().task = std::move(task);
+        mDirty = true;
+        return mNodes.size() - 1;
+    }
+
+    /**
+    Adds a dependency between two of this TaskGraph object's tasks
+    @param [in] predecessor The index of the task that must complete first
+    @param [in] successor The index of the task that must wait for the predecessor to complete
+        @note Dependencies must not form a cycle
+        @note This method must not be called while this TaskGraph is running
+    */
+    inline void add_dependency(size_t predecessor, size_t successor)
+    {
+        assert(predecessor < mNodes.size() && successor < mNodes.size() && predecessor != successor);
+        mNodes[predecessor].successors.push_back(successor);
+        ++mNodes[successor].predecessorCount;
+        mDirty = true;
+    }
+
+    /**
+    Gets this TaskGraph object's number of tasks
+    @return This TaskGraph object's number of tasks
+    */
+    inline size_t get_task_count() const
+    {
+        return mNodes.size();
+    }
+
+    /**
+    Processes all of this TaskGraph object's tasks on a given ThreadPool
+    @param [in] threadPool The ThreadPool to process this TaskGraph object's tasks on
+        @note The calling thread processes pending tasks until all of this TaskGraph object's tasks are complete, this method may be called from the given ThreadPool object's threads
+        @note If any task throws, its successors are still processed and the first exception thrown is rethrown after all tasks are complete
+        @note If ThreadPool::clear() drops a queued task, that task and every task that depends on it (recursively) isn't processed during this call
+        @note This method must not be called concurrently for the same TaskGraph
+    */
+    inline void run(ThreadPool& threadPool)
+    {
+        if (mDirty) {
+            update();
+        }
+        if (!mNodes.empty()) {
+            for (size_t i = 0; i < mNodes.size(); ++i) {
+                mupPendingPredecessorCounts[i].store(mNodes[i].predecessorCount, std::memory_order_relaxed);
+                mupSkipped[i].store(false, std::memory_order_relaxed);
+            }
+            mException = nullptr;
+            mExceptionCaptured.clear();
+            mIncompleteTaskCount.store(mNodes.size(), std::memory_order_release);
+            for (auto root : mRoots) {
+                threadPool.push_detached(NodeTask(*this, threadPool, root));
+            }
+            threadPool.process_pending_tasks_until([&]() { return !mIncompleteTaskCount.load(std::memory_order_acquire); });
+            if (mException) {
+                std::rethrow_exception(mException);
+            }
+        }
+    }
+
+    /**
+    Removes all tasks and dependencies from this TaskGraph
+        @note This method must not be called while this TaskGraph is running
+    */
+    inline void clear()
+    {
+        mNodes.clear();
+        mDirty = true;
+    }
+
+private:
+    struct Node final
+    {
+        Action<> task;
+        std::vector<size_t> successors;
+        size_t predecessorCount { 0 };
+    };
+
+    struct NodeTask final
+    {
+        // NOTE : A NodeTask that's destroyed without being processed, ie. dropped by
+        //  ThreadPool::clear(), skips its node so that run() doesn't wait forever.
+        inline NodeTask(TaskGraph& taskGraph, ThreadPool& threadPool, size_t node)
+            : pTaskGraph { &taskGraph }
+            , pThreadPool { &threadPool }
+            , node { node }
+        {
+        }
+
+        inline NodeTask(NodeTask&& other) noexcept
+            : pTaskGraph { std::exchange(other.pTaskGraph, nullptr) }
+            , pThreadPool { other.pThreadPool }
+            , node { other.node }
+        {
+        }
+
+        inline ~NodeTask()
+        {
+            if (pTaskGraph) {
+                pTaskGraph->mupSkipped[node].store(true, std::memory_order_relaxed);
+                pTaskGraph->process(*pThreadPool, node);
+            }
+        }
+
+        inline void operator()()
+        {
+            std::exchange(pTaskGraph, nullptr)->process(*pThreadPool, node);
+        }
+
+        TaskGraph* pTaskGraph { nullptr };
+        ThreadPool* pThreadPool { nullptr };
+        size_t node { 0 };
+    };
+
+    inline void update()
+    {
+        mRoots.clear();
+        for (size_t i = 0; i < mNodes.size(); ++i) {
+            if (!mNodes[i].predecessorCount) {
+                mRoots.push_back(i);
+            }
+        }
+        mupPendingPredecessorCounts = std::make_unique<std::atomic_size_t[]>(mNodes.size());
+        mupSkipped = std::make_unique<std::atomic_bool[]>(mNodes.size());
+        #ifndef NDEBUG
+        // NOTE : A cycle would leave tasks that never become ready and run() would
+        //  never return, Kahn's algorithm visits every task iff there's no cycle.
+        std::vector<size_t> predecessorCounts(mNodes.size());
+        for (size_t i = 0; i < mNodes.size(); ++i) {
+            predecessorCounts[i] = mNodes[i].predecessorCount;
+        }
+        auto ready = mRoots;
+        size_t visitedCount = 0;
+        while (!ready.empty()) {
+            auto node = ready.back();
+            ready.pop_back();
+            ++visitedCount;
+            for (auto successor : mNodes[node].successors) {
+                if (!--predecessorCounts[successor]) {
+                    ready.push_back(successor);
+                }
+            }
+        }
+        assert(visitedCount == mNodes.size() && "TaskGraph dependencies must not form a cycle");
+        #endif
+        mDirty = false;
+    }
+
+    inline void process(ThreadPool& threadPool, size_t node)
+    {
+        // NOTE : The first successor released by a task is processed on the same
+        //  thread, the rest are queued for other threads to pick up.  Skipped nodes
+        //  mark their successors skipped, skipped successors are released on the
+        //  same thread since they don't process their tasks.  Nothing in this
+        //  TaskGraph may be accessed after the last decrement of
+        //  mIncompleteTaskCount since run() may have returned.
+        const auto None = (size_t)-1;
+        std::vector<size_t> skippedNodes;
+        while (node != None) {
+            auto skipped = mupSkipped[node].load(std::memory_order_relaxed);
+            if (!skipped) {
+                try {
+                    if (mNodes[node].task) {
+                        mNodes[node].task();
+                    }
+                } catch (...) {
+                    if (!mExceptionCaptured.test_and_set()) {
+                        mException = std::current_exception();
+                    }
+                }
+            }
+            auto nextNode = None;
+            for (auto successor : mNodes[node].successors) {
+                if (skipped) {
+                    mupSkipped[successor].store(true, std::memory_order_relaxed);
+                }
+                if (mupPendingPredecessorCounts[successor].fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                    if (mupSkipped[successor].load(std::memory_order_relaxed)) {
+                        skippedNodes.push_back(successor);
+                    } else if (nextNode == None) {
+                        nextNode = successor;
+                    } else {
+                        threadPool.push_detached(NodeTask(*this, threadPool, successor));
+                    }
+                }
+            }
+            if (mIncompleteTaskCount.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                threadPool.notify_waiters();
+            }
+            node = nextNode;
+            if (node == None && !skippedNodes.empty()) {
+                node = skippedNodes.back();
+                skippedNodes.pop_back();
+            }
+        }
+    }
+
+    std::vector<Node> mNodes;
+    std::vector<size_t> mRoots;
+    std::unique_ptr<std::atomic_size_t[]> mupPendingPredecessorCounts;
+    std::unique_ptr<std::atomic_bool[]> mupSkipped;
+    std::atomic_size_t mIncompleteTaskCount { 0 };
+    std::exception_ptr mException;
+    std::atomic_flag mExceptionCaptured = ATOMIC_FLAG_INIT;
+    bool mDirty { true };
+    TaskGraph(const TaskGraph&) = delete;
+    TaskGraph& operator=(const TaskGraph&) = delete;
+};
+
+} // namespace dst
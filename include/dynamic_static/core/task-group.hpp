@@ -0,0 +1,160 @@
+/*
+==========================================
+  Copyright (c) 2020 Dynamic_Static
+    Patrick Purcell
+      Licensed under the MIT license
+    http://opensource.org/licenses/MIT
+==========================================
+*/
+
+#pragma once
+
+#include "dynamic_static/core/defines.hpp"
+#include "dynamic_static/core/thread-pool.hpp"
+
+#include <atomic>
+#include <exception>
+#include <type_traits>
+#include <utility>
+
+namespace dst {
+
+/**
+Tracks completion of a group of tasks queued on a ThreadPool
+    @note Waiting on a TaskGroup only waits for tasks pushed through that TaskGroup, unlike ThreadPool::wait() which waits for all of a ThreadPool object's tasks
+*/
+class TaskGroup final
+{
+public:
+    /**
+    Constructs an instance of TaskGroup
+    @param [in] threadPool The ThreadPool to queue this TaskGroup object's tasks on
+    */
+    inline TaskGroup(ThreadPool& threadPool)
+        : mThreadPool { threadPool }
+    {
+    }
+
+    /**
+    Destroys this instance of TaskGroup
+        @note Waits for this TaskGroup object's pending tasks, exceptions thrown by this TaskGroup object's tasks are discarded
+    */
+    inline ~TaskGroup()
+    {
+        mThreadPool.process_pending_tasks_until([&]() { return !mTaskCount.load(std::memory_order_acquire); });
+    }
+
+    /**
+    Gets this TaskGroup object's number of incomplete tasks
+        @note The value retuned by this method may be stale by the time it's read
+    */
+    inline size_t get_task_count() const
+    {
+        return mTaskCount;
+    }
+
+    /**
+    Queues a task for processing on this TaskGroup object's ThreadPool
+    @param <TaskType> The type of task to queue for processing
+    @param [in] task The task to queue for processing
+        @note Equivalent to push(task, ThreadPool::PushInfo { })
+    */
+    template <typename TaskType>
+    inline void push(TaskType task)
+    {
+        push(std::move(task), ThreadPool::PushInfo { });
+    }
+
+    /**
+    Queues a task for processing on this TaskGroup object's ThreadPool
+    @param <TaskType> The type of task to queue for processing
+    @param [in] task The task to queue for processing
+    @param [in] pushInfo The ThreadPool::PushInfo to use to queue the given task
+        @note TaskType must have a signature compatible with void()
+        @note If the given task throws, the first exception thrown by this TaskGroup object's tasks is rethrown by wait()
+        @note If the given task is dropped without being processed, ie. by ThreadPool::clear() or because pushInfo.cancellationToken was cancelled, it counts as complete
+    */
+    template <typename TaskType>
+    inline void push(TaskType task, const ThreadPool::PushInfo& pushInfo)
+    {
+        mTaskCount.fetch_add(1, std::memory_order_relaxed);
+        mThreadPool.push_detached(GroupTask<TaskType>(*this, std::move(task)), pushInfo);
+    }
+
+    /**
+    Processes pending tasks on the calling thread until all of this TaskGroup object's tasks are complete
+        @note The calling thread processes any of the ThreadPool object's pending tasks, not only this TaskGroup object's tasks
+        @note If any of this TaskGroup object's tasks threw, the first exception thrown is rethrown and cleared
+        @note This method may be called from the ThreadPool object's threads
+    */
+    inline void wait()
+    {
+        mThreadPool.process_pending_tasks_until([&]() { return !mTaskCount.load(std::memory_order_acquire); });
+        if (mException) {
+            auto exception = std::move(mException);
+            mException = nullptr;
+            mExceptionCaptured.clear();
+            std::rethrow_exception(exception);
+        }
+    }
+
+private:
+    template <typename TaskType>
+    struct GroupTask final
+    {
+        // NOTE : A GroupTask that's destroyed without being processed still releases
+        //  its TaskGroup so that wait() doesn't wait forever.
+        inline GroupTask(TaskGroup& taskGroup, TaskType task)
+            : pTaskGroup { &taskGroup }
+            , task(std::move(task))
+        {
+        }
+
+        inline GroupTask(GroupTask&& other) noexcept(std::is_nothrow_move_constructible<TaskType>::value)
+            : pTaskGroup { std::exchange(other.pTaskGroup, nullptr) }
+            , task(std::move(other.task))
+        {
+        }
+
+        inline ~GroupTask()
+        {
+            if (pTaskGroup) {
+                pTaskGroup->release();
+            }
+        }
+
+        inline void operator()()
+        {
+            auto pTaskGroup = std::exchange(this->pTaskGroup, nullptr);
+            try {
+                task();
+            } catch (...) {
+                if (!pTaskGroup->mExceptionCaptured.test_and_set()) {
+                    pTaskGroup->mException = std::current_exception();
+                }
+            }
+            pTaskGroup->release();
+        }
+
+        TaskGroup* pTaskGroup { nullptr };
+        TaskType task;
+    };
+
+    inline void release()
+    {
+        // NOTE : This TaskGroup may be destroyed as soon as mTaskCount reaches 0.
+        auto& threadPool = mThreadPool;
+        if (mTaskCount.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            threadPool.notify_waiters();
+        }
+    }
+
+    ThreadPool& mThreadPool;
+    std::atomic_size_t mTaskCount { 0 };
+    std::exception_ptr mException;
+    std::atomic_flag mExceptionCaptured = ATOMIC_FLAG_INIT;
+    TaskGroup(const TaskGroup&) = delete;
+    TaskGroup& operator=(const TaskGroup&) = delete;
+};
+
+} // namespace dst
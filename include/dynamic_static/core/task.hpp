@@ -0,0 +1,378 @@
+/*
+==========================================
+  Copyright (c) 2020 Dynamic_Static
+    Patrick Purcell
+      Licensed under the MIT license
+    http://opensource.org/licenses/MIT
+==========================================
+*/
+
+#pragma once
+
+#include "dynamic_static/core/defines.hpp"
+#include "dynamic_static/core/thread-pool.hpp"
+
+#if defined(DYNAMIC_STATIC_COROUTINES_ENABLED)
+
+#include <cassert>
+#include <coroutine>
+#include <exception>
+#include <type_traits>
+#include <utility>
+
+namespace dst {
+
+template <typename T = void>
+class Task;
+
+namespace detail {
+
+/**
+Common base for Task<> promise types
+@param <T> The type of the Task<> object's result
+*/
+template <typename T>
+class TaskPromiseBase
+{
+public:
+    /**
+    Resumes a Task<> object's continuation when the Task<> completes
+    */
+    class FinalAwaiter final
+    {
+    public:
+        inline bool await_ready() const noexcept
+        {
+            return false;
+        }
+
+        template <typename PromiseType>
+        inline std::coroutine_handle<> await_suspend(std::coroutine_handle<PromiseType> handle) noexcept
+        {
+            auto continuation = handle.promise().mContinuation;
+            return continuation ? continuation : std::noop_coroutine();
+        }
+
+        inline void await_resume() const noexcept
+        {
+        }
+    };
+
+    /**
+    Task<> objects don't start until they're awaited
+    */
+    inline std::suspend_always initial_suspend() const noexcept
+    {
+        return { };
+    }
+
+    /**
+    Task<> objects resume their continuation when they complete
+    */
+    inline FinalAwaiter final_suspend() const noexcept
+    {
+        return { };
+    }
+
+    /**
+    Stores the exception thrown by a Task<> so it's rethrown to the awaiting coroutine
+    */
+    inline void unhandled_exception()
+    {
+        mState.set_exception(std::current_exception());
+    }
+
+    /**
+    Sets the coroutine to resume when a Task<> completes
+    @param [in] continuation The coroutine to resume when a Task<> completes
+    */
+    inline void set_continuation(std::coroutine_handle<> continuation)
+    {
+        mContinuation = continuation;
+    }
+
+    /**
+    Gets a Task<> object's result
+    @return A Task<> object's result
+        @note If the Task<> threw, the exception is rethrown
+    */
+    inline T get()
+    {
+        return mState.get();
+    }
+
+protected:
+    FutureState<T> mState;
+
+private:
+    std::coroutine_handle<> mContinuation;
+};
+
+/**
+Promise type for Task<> objects that produce a value
+@param <T> The type of the Task<> object's result
+*/
+template <typename T>
+class TaskPromise final
+    : public TaskPromiseBase<T>
+{
+public:
+    /**
+    Gets the Task<> associated with this TaskPromise<>
+    @return The Task<> associated with this TaskPromise<>
+    */
+    inline Task<T> get_return_object() noexcept
+    {
+        return Task<T>(std::coroutine_handle<TaskPromise>::from_promise(*this));
+    }
+
+    /**
+    Stores a Task<> object's result
+    @param <ValueType> The type of value to store
+    @param [in] value The value to store
+    */
+    template <typename ValueType>
+    inline void return_value(ValueType&& value)
+    {
+        this->mState.set_value(std::forward<ValueType>(value));
+    }
+};
+
+/**
+Promise type for Task<> objects that don't produce a value
+*/
+template <>
+class TaskPromise<void> final
+    : public TaskPromiseBase<void>
+{
+public:
+    /**
+    Gets the Task<> associated with this TaskPromise<>
+    @return The Task<> associated with this TaskPromise<>
+    */
+    inline Task<void> get_return_object() noexcept;
+
+    /**
+    Marks a Task<> as complete
+    */
+    inline void return_void()
+    {
+        mState.set_value();
+    }
+};
+
+/**
+Coroutine type that starts immediately and destroys itself on completion
+*/
+class DetachedTask final
+{
+public:
+    class promise_type final
+    {
+    public:
+        inline DetachedTask get_return_object() const noexcept
+        {
+            return { };
+        }
+
+        inline std::suspend_never initial_suspend() const noexcept
+        {
+            return { };
+        }
+
+        inline std::suspend_never final_suspend() const noexcept
+        {
+            return { };
+        }
+
+        inline void return_void() const noexcept
+        {
+        }
+
+        inline void unhandled_exception() const noexcept
+        {
+            std::terminate();
+        }
+    };
+};
+
+template <typename T>
+inline DetachedTask start_sync_wait(Task<T> task, FutureState<T>& state, ThreadPool& threadPool)
+{
+    // NOTE : Nothing but the parameters copied into this coroutine's frame may be
+    //  accessed after the result is stored since sync_wait() may have returned.
+    try {
+        if constexpr (std::is_void<T>::value) {
+            co_await std::move(task);
+            state.set_value();
+        } else {
+            state.set_value(co_await std::move(task));
+        }
+    } catch (...) {
+        state.set_exception(std::current_exception());
+    }
+    threadPool.notify_waiters();
+}
+
+} // namespace detail
+
+/**
+Coroutine that produces a value of a specified type
+@param <T> The type of this Task<> object's result
+    @note A Task<> doesn't start until it's awaited, awaiting a Task<> resumes the awaiting coroutine on the thread that completes the Task<>
+    @note Use co_await ThreadPool::schedule() to continue a Task<> on a ThreadPool object's threads
+    @note Use sync_wait() to wait for a Task<> from code that isn't a coroutine
+*/
+template <typename T>
+class Task final
+{
+public:
+    /**
+    The promise type of Task<> coroutines
+    */
+    using promise_type = detail::TaskPromise<T>;
+
+    /**
+    Awaitable that starts a Task<> and resumes the awaiting coroutine when the Task<> completes
+    */
+    class Awaiter final
+    {
+    public:
+        inline bool await_ready() const noexcept
+        {
+            assert(mHandle && "Task<> must be valid to be awaited");
+            return mHandle.done();
+        }
+
+        inline std::coroutine_handle<> await_suspend(std::coroutine_handle<> continuation) noexcept
+        {
+            mHandle.promise().set_continuation(continuation);
+            return mHandle;
+        }
+
+        inline T await_resume()
+        {
+            return mHandle.promise().get();
+        }
+
+    private:
+        inline Awaiter(std::coroutine_handle<promise_type> handle)
+            : mHandle { handle }
+        {
+        }
+
+        std::coroutine_handle<promise_type> mHandle;
+        friend class Task;
+    };
+
+    /**
+    Constructs an instance of Task<>
+        @note A default constructed Task<> isn't valid
+    */
+    Task() = default;
+
+    /**
+    Moves an instance of Task<>
+    @param [in] other The Task<> to move from
+    */
+    inline Task(Task&& other) noexcept
+        : mHandle { std::exchange(other.mHandle, nullptr) }
+    {
+    }
+
+    /**
+    Destroys this instance of Task<>
+    */
+    inline ~Task()
+    {
+        if (mHandle) {
+            mHandle.destroy();
+        }
+    }
+
+    /**
+    Moves an instance of Task<>
+    @param [in] other The Task<> to move from
+    @return A reference to this Task<>
+    */
+    inline Task& operator=(Task&& other) noexcept
+    {
+        if (this != &other) {
+            if (mHandle) {
+                mHandle.destroy();
+            }
+            mHandle = std::exchange(other.mHandle, nullptr);
+        }
+        return *this;
+    }
+
+    /**
+    Gets a value indicating whether or not this Task<> refers to a coroutine
+    @return Whether or not this Task<> refers to a coroutine
+    */
+    inline bool valid() const
+    {
+        return (bool)mHandle;
+    }
+
+    /**
+    Gets a value indicating whether or not this Task<> has completed
+    @return Whether or not this Task<> has completed
+    */
+    inline bool is_ready() const
+    {
+        return !mHandle || mHandle.done();
+    }
+
+    /**
+    Gets an awaitable that starts this Task<> and resumes the awaiting coroutine when this Task<> completes
+    @return The awaitable Task<>::Awaiter
+        @note The result of the co_await expression is this Task<> object's result, if this Task<> threw the exception is rethrown
+    */
+    inline Awaiter operator co_await() && noexcept
+    {
+        return Awaiter(mHandle);
+    }
+
+private:
+    inline explicit Task(std::coroutine_handle<promise_type> handle)
+        : mHandle { handle }
+    {
+    }
+
+    std::coroutine_handle<promise_type> mHandle;
+    friend class detail::TaskPromise<T>;
+    Task(const Task&) = delete;
+    Task& operator=(const Task&) = delete;
+};
+
+namespace detail {
+
+inline Task<void> TaskPromise<void>::get_return_object() noexcept
+{
+    return Task<void>(std::coroutine_handle<TaskPromise>::from_promise(*this));
+}
+
+} // namespace detail
+
+/**
+Starts a Task<> on the calling thread and processes a given ThreadPool object's pending tasks until the Task<> completes
+@param <T> The type of the Task<> object's result
+@param [in] threadPool The ThreadPool to process pending tasks from
+@param [in] task The Task<> to wait for
+@return The Task<> object's result
+    @note If the Task<> threw, the exception is rethrown
+    @note This function may be called from the given ThreadPool object's threads
+*/
+template <typename T>
+inline T sync_wait(ThreadPool& threadPool, Task<T> task)
+{
+    detail::FutureState<T> state;
+    detail::start_sync_wait(std::move(task), state, threadPool);
+    threadPool.process_pending_tasks_until([&]() { return state.is_ready(); });
+    return state.get();
+}
+
+} // namespace dst
+
+#endif // DYNAMIC_STATIC_COROUTINES_ENABLED
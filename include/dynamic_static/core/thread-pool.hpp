@@ -1,4 +1,3 @@
-
 /*
 ==========================================
   Copyright (c) 2015-2020 Dynamic_Static
@@ -10,65 +9,455 @@
 
 #pragma once
 
+#include "dynamic_static/core/cancellation-token.hpp"
 #include "dynamic_static/core/defines.hpp"
+#include "dynamic_static/core/inline-function.hpp"
+#include "dynamic_static/core/time.hpp"
+#include "dynamic_static/core/timer-wheel.hpp"
+
+#if defined(DYNAMIC_STATIC_COMPILER_MSVC)
+#include <intrin.h>
+#endif
+#if defined(DYNAMIC_STATIC_COROUTINES_ENABLED)
+#include <coroutine>
+#endif
+#if defined(DYNAMIC_STATIC_PLATFORM_LINUX)
+#include <pthread.h>
+#include <sched.h>
+#endif
 
+#include <algorithm>
+#include <array>
 #include <atomic>
+#include <cassert>
 #include <condition_variable>
+#include <deque>
+#include <exception>
+#include <fstream>
+#include <functional>
 #include <future>
+#include <iterator>
+#include <memory>
 #include <mutex>
-#include <queue>
+#include <optional>
+#include <string>
 #include <thread>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
 namespace dst {
 
+class ThreadPool;
+
+namespace detail {
+
+/**
+Shared state between a task queued on a ThreadPool and its Future<>
+@param <T> The type of the task's result
+*/
+template <typename T>
+class FutureState final
+{
+public:
+    /**
+    Gets a value indicating whether or not this FutureState<> has a result or an exception
+    @return Whether or not this FutureState<> has a result or an exception
+    */
+    inline bool is_ready() const
+    {
+        return mReady.load(std::memory_order_acquire);
+    }
+
+    /**
+    Calls a given function and stores its result or the exception it throws
+    @param <FunctionType> The type of function to call
+    @param [in] function The function to call
+        @note FunctionType must have a signature compatible with T()
+    */
+    template <typename FunctionType>
+    inline void run(FunctionType& function)
+    {
+        try {
+            if constexpr (std::is_void<T>::value) {
+                function();
+            } else {
+                mValue.emplace(function());
+            }
+        } catch (...) {
+            mException = std::current_exception();
+        }
+        mReady.store(true, std::memory_order_release);
+    }
+
+    /**
+    Stores a given result
+    @param <Args> The types of arguments used to construct the result
+    @param [in] args The arguments used to construct the result
+    */
+    template <typename ...Args>
+    inline void set_value(Args&&... args)
+    {
+        if constexpr (!std::is_void<T>::value) {
+            mValue.emplace(std::forward<Args>(args)...);
+        }
+        mReady.store(true, std::memory_order_release);
+    }
+
+    /**
+    Stores a given exception
+    @param [in] exception The exception to store
+    */
+    inline void set_exception(std::exception_ptr exception)
+    {
+        mException = std::move(exception);
+        mReady.store(true, std::memory_order_release);
+    }
+
+    /**
+    Gets this FutureState<> object's result
+    @return This FutureState<> object's result
+        @note This FutureState<> must be ready
+        @note If an exception was stored it's rethrown
+    */
+    inline T get()
+    {
+        assert(is_ready());
+        if (mException) {
+            std::rethrow_exception(mException);
+        }
+        if constexpr (std::is_reference<T>::value) {
+            return mValue->get();
+        } else if constexpr (!std::is_void<T>::value) {
+            return std::move(*mValue);
+        }
+    }
+
+private:
+    using ValueType = typename std::conditional<
+        std::is_void<T>::value,
+        std::nullptr_t,
+        typename std::conditional<
+            std::is_reference<T>::value,
+            std::reference_wrapper<typename std::remove_reference<T>::type>,
+            T
+        >::type
+    >::type;
+
+    std::atomic_bool mReady { false };
+    std::optional<ValueType> mValue;
+    std::exception_ptr mException;
+};
+
+} // namespace detail
+
+/**
+Provides access to the result of a task queued on a ThreadPool
+@param <T> The type of the task's result
+    @note Waiting on a Future<> processes the ThreadPool object's pending tasks on the calling thread until the result is ready, so a Future<> can be waited on from the ThreadPool object's threads without dead locking
+    @note A Future<> whose result is ready can be used after its ThreadPool is destroyed, ThreadPool::~ThreadPool() processes all pending tasks
+*/
+template <typename T>
+class Future final
+{
+public:
+    /**
+    Constructs an instance of Future<>
+        @note A default constructed Future<> isn't valid
+    */
+    Future() = default;
+
+    /**
+    Moves an instance of Future<>
+    @param [in] other The Future<> to move from
+    */
+    Future(Future&& other) = default;
+
+    /**
+    Moves an instance of Future<>
+    @param [in] other The Future<> to move from
+    @return A reference to this Future<>
+    */
+    Future& operator=(Future&& other) = default;
+
+    /**
+    Gets a value indicating whether or not this Future<> refers to a result
+    @return Whether or not this Future<> refers to a result
+        @note A Future<> is no longer valid after get() is called
+    */
+    inline bool valid() const
+    {
+        return mspState != nullptr;
+    }
+
+    /**
+    Gets a value indicating whether or not this Future<> object's result is ready
+    @return Whether or not this Future<> object's result is ready
+        @note This method doesn't block or process pending tasks
+    */
+    inline bool is_ready() const
+    {
+        assert(valid());
+        return mspState->is_ready();
+    }
+
+    /**
+    Processes this Future<> object's ThreadPool object's pending tasks on the calling thread until this Future<> object's result is ready
+    */
+    inline void wait() const;
+
+    /**
+    Waits for and gets this Future<> object's result
+    @return This Future<> object's result
+        @note If the task associated with this Future<> threw, the exception is rethrown
+        @note This Future<> is no longer valid after this method is called
+    */
+    inline T get()
+    {
+        wait();
+        auto spState = std::move(mspState);
+        return spState->get();
+    }
+
+private:
+    inline Future(ThreadPool& threadPool, std::shared_ptr<detail::FutureState<T>> spState)
+        : mpThreadPool { &threadPool }
+        , mspState { std::move(spState) }
+    {
+    }
+
+    ThreadPool* mpThreadPool { nullptr };
+    std::shared_ptr<detail::FutureState<T>> mspState;
+    friend class ThreadPool;
+    Future(const Future&) = delete;
+    Future& operator=(const Future&) = delete;
+};
+
 /**
 Provides high level control over a collection of threads
+    @note Each thread owns a queue of tasks, tasks pushed from one of this ThreadPool object's threads are queued on that thread's queue and tasks pushed from any other thread are distributed across all queues
+    @note Threads process their own queue first, threads with an empty queue steal tasks from other queues, tasks in each queue are processed in the order they were pushed
+    @note Queued tasks are stored in recycled fixed size slots, tasks that fit in TaskCapacity bytes are queued without allocating
+    @note Each queue has a lane per Priority, threads process higher Priority lanes first, every StarvationInterval tasks a thread processes lower Priority lanes first so that lower Priority tasks aren't starved
+    @note Idle threads spin, then yield, then block according to CreateInfo::spinDuration and CreateInfo::yieldDuration
+    @note Threads can be pinned to CPUs or NUMA nodes with CreateInfo::affinity, threads steal from threads on the same node before threads on other nodes
+    @note Waiting on a Future<> returned by push() or push_batch() processes pending tasks on the waiting thread, so tasks can wait on other tasks without dead locking
+    @note Each thread records Statistics that can be read without locking with get_statistics()
+    @note Tasks pushed with a PushInfo::cancellationToken are dropped when they're dequeued if cancellation was requested, running tasks can poll get_current_cancellation_token()
+    @note The number of threads can be changed with resize(), and can grow and shrink automatically between CreateInfo::threadCount and CreateInfo::maxThreadCount
+    @note Tasks can be delayed or repeated with push_after() and push_every(), all timers are tracked by a single timer thread that's started when the first timer is created
+    @note A ThreadPool created with 0 threads or with an Execution other than Execution::Threaded has no threads and processes tasks on the calling thread, so the same code can be profiled and debugged serially
 */
 class ThreadPool final
 {
 public:
+    /**
+    The size in bytes of the inline storage available to each queued task
+    */
+    static constexpr size_t TaskCapacity { 5 * sizeof(void*) };
+
+    /**
+    The number of tasks a thread processes between each time it favors lower Priority tasks
+    */
+    static constexpr size_t StarvationInterval { 16 };
+
+    /**
+    The value of PushInfo::node that allows tasks to be processed by any thread
+    */
+    static constexpr size_t AnyNode { (size_t)-1 };
+
+    /**
+    The number of buckets in Statistics::latencyHistogram
+    */
+    static constexpr size_t LatencyHistogramBucketCount { 32 };
+
+    /**
+    The granularity of delays and periods passed to push_after() and push_every()
+    */
+    static constexpr Milliseconds<> TimerResolution { 1 };
+
+    /**
+    Identifies a timer created with push_after() or push_every()
+    */
+    using TimerId = TimerWheel<int>::Id;
+
+    /**
+    Specifies the priority of a queued task
+    */
+    enum class Priority
+    {
+        High,   //!< Processed before Normal and Low tasks
+        Normal, //!< Processed before Low tasks
+        Low,    //!< Processed after High and Normal tasks
+        Count,  //!< The number of Priority values
+    };
+
+    /**
+    Specifies parameters for queueing tasks
+    */
+    struct PushInfo final
+    {
+        Priority priority { Priority::Normal };  //!< The Priority of queued tasks
+        size_t node { AnyNode };                 //!< The index of the node whose threads' queues tasks are queued on, AnyNode or an out of range index queues tasks on any thread's queue
+        CancellationToken cancellationToken { }; //!< Queued tasks are dropped without being processed if this CancellationToken is cancelled before they're dequeued
+    };
+
+    /**
+    Specifies how ThreadPool threads are placed on CPUs
+    */
+    enum class Affinity
+    {
+        None, //!< Threads aren't pinned and the ThreadPool has a single node
+        Node, //!< Threads are grouped per NUMA node and each thread is pinned to all of its node's CPUs
+        Core, //!< Threads are grouped per NUMA node and each thread is pinned to one of its node's CPUs
+    };
+
+    /**
+    Specifies where and when a ThreadPool processes tasks
+    */
+    enum class Execution
+    {
+        Threaded,  //!< Tasks are processed by the ThreadPool object's threads
+        Deferred,  //!< The ThreadPool has no threads, tasks are queued and processed in Priority order by threads waiting on the ThreadPool, ie. in wait() or Future<>::wait()
+        Immediate, //!< The ThreadPool has no threads, tasks are processed on the pushing thread before push() returns
+    };
+
+    /**
+    Specifies parameters for ThreadPool creation
+    */
+    struct CreateInfo final
+    {
+        size_t threadCount { std::max(std::thread::hardware_concurrency(), 1u) }; //!< The number of threads, if 0 the ThreadPool has no threads and uses Execution::Deferred
+        Microseconds<> spinDuration { 0 };                           //!< How long idle threads spin checking for tasks before yielding
+        Microseconds<> yieldDuration { 0 };                          //!< How long idle threads yield between checks for tasks before blocking
+        Affinity affinity { Affinity::None };                        //!< How threads are placed on CPUs
+        std::vector<size_t> cpus;                                    //!< The CPUs threads may be placed on when affinity isn't Affinity::None, if empty all CPUs available to the process are used
+        bool timingStatisticsEnabled { false };                      //!< Whether or not durations and task latencies are recorded in Statistics, recording timings reads the clock when tasks are queued and processed
+        size_t maxThreadCount { 0 };                                 //!< The maximum number of threads resize() and elastic growth can run, if less than threadCount threadCount is used
+        Milliseconds<> growLatency { 0 };                            //!< If not 0, a thread is started (up to maxThreadCount) when a task waits longer than this to be processed
+        Milliseconds<> retireTimeout { 0 };                          //!< If not 0, threads started beyond the current minimum thread count are stopped after being idle this long
+        Execution execution { Execution::Threaded };                 //!< Where and when tasks are processed, if not Execution::Threaded the ThreadPool has no threads and threadCount, affinity, and elastic growth are ignored
+    };
+
+    /**
+    Counters recorded for a thread processing a ThreadPool object's tasks
+    */
+    struct ThreadStatistics final
+    {
+        uint64_t executedTaskCount { 0 };  //!< The number of tasks processed
+        uint64_t stolenTaskCount { 0 };    //!< The number of tasks taken from other threads' queues
+        uint64_t cancelledTaskCount { 0 }; //!< The number of tasks dropped without being processed because their PushInfo::cancellationToken was cancelled
+        uint64_t queueHighWaterMark { 0 }; //!< The largest number of tasks queued on this thread's queue at once
+        Nanoseconds<> busyDuration { 0 };  //!< The time spent processing tasks, only recorded if CreateInfo::timingStatisticsEnabled is set
+        Nanoseconds<> spinDuration { 0 };  //!< The time spent spinning or yielding while idle, only recorded if CreateInfo::timingStatisticsEnabled is set
+        Nanoseconds<> idleDuration { 0 };  //!< The time spent blocked while idle, only recorded if CreateInfo::timingStatisticsEnabled is set
+    };
+
+    /**
+    Snapshot of the counters recorded by a ThreadPool
+    */
+    struct Statistics final
+    {
+        std::vector<ThreadStatistics> threads;                                //!< The ThreadStatistics of each of the ThreadPool object's thread slots, including slots whose threads are stopped
+        ThreadStatistics otherThreads;                                        //!< The combined ThreadStatistics of threads that processed tasks while waiting, ie. in Future<>::wait(), queueHighWaterMark isn't used
+        std::array<uint64_t, LatencyHistogramBucketCount> latencyHistogram { }; //!< The number of tasks by time from being queued to being processed, bucket 0 counts latencies under 2 ns, bucket i counts latencies in [2^i, 2^(i + 1)) ns, the last bucket also counts longer latencies, only recorded if CreateInfo::timingStatisticsEnabled is set
+    };
+
     /**
     Constructs an instance of ThreadPool
     @param [in] count (optional = std::thread::hardware_concurrency()) This ThreadPool object's number of threads
-        @note If count is 0 std::thread::hardware_concurrency() will be used
-    */
-    inline ThreadPool(size_t count = std::thread::hardware_concurrency())
-    {
-        count = count ? count : std::thread::hardware_concurrency();
-        mThreads.reserve(count);
-        for (size_t i = 0; i < count; ++i) {
-            mThreads.emplace_back(
-                [&]()
-                {
-                    while (mActive) {
-                        std::unique_lock<std::mutex> lock(mMutex);
-                        mTaskReceived.wait(lock, [&]() { return !mTasks.empty() || !mActive; });
-                        lock.unlock();
-                        ++mActiveThreadCount;
-                        for (auto task = std::move(get_task()); task.valid(); task = std::move(get_task())) {
-                            task();
-                        }
-                        if (!--mActiveThreadCount) {
-                            mTasksComplete.notify_all();
-                        }
-                    }
+        @note If count is 0 this ThreadPool has no threads and uses Execution::Deferred
+        @note Idle threads block immediately, use ThreadPool(const CreateInfo&) to configure idle threads to spin or yield
+    */
+    inline ThreadPool(size_t count = std::max(std::thread::hardware_concurrency(), 1u))
+        : ThreadPool(make_create_info(count))
+    {
+    }
+
+    /**
+    Constructs an instance of ThreadPool
+    @param [in] createInfo This ThreadPool object's CreateInfo
+        @note Spinning or yielding avoids the cost of blocking and being woken for tasks pushed in quick succession at the cost of burning CPU time while idle
+        @note Threads are distributed across NUMA nodes in proportion to each node's number of CPUs
+        @note Affinity is only applied on Linux, on other platforms threads aren't pinned and the ThreadPool has a single node
+        @note A thread slot is allocated for each of up to maxThreadCount threads, slots are assigned to nodes and threads are started in slot order
+    */
+    inline ThreadPool(const CreateInfo& createInfo)
+        : mSpinDuration { duration_cast<SteadyClock::duration>(createInfo.spinDuration) }
+        , mYieldDuration { duration_cast<SteadyClock::duration>(createInfo.yieldDuration) }
+        , mGrowLatency { duration_cast<SteadyClock::duration>(createInfo.growLatency) }
+        , mRetireTimeout { duration_cast<SteadyClock::duration>(createInfo.retireTimeout) }
+        , mTimingStatisticsEnabled { createInfo.timingStatisticsEnabled }
+        , mExecution { createInfo.threadCount ? createInfo.execution : Execution::Deferred }
+    {
+        // NOTE : Without threads a single slot that's never started holds the queues.
+        auto threaded = mExecution == Execution::Threaded;
+        auto threadCount = threaded ? createInfo.threadCount : 0;
+        auto count = threaded ? std::max(createInfo.maxThreadCount, threadCount) : 1;
+        auto nodeCpus = threaded && createInfo.affinity != Affinity::None ? get_node_cpus(createInfo.cpus) : std::vector<std::vector<size_t>> { };
+        if (nodeCpus.empty()) {
+            nodeCpus.emplace_back();
+        }
+        size_t cpuCount = 0;
+        for (const auto& cpus : nodeCpus) {
+            cpuCount += std::max(cpus.size(), (size_t)1);
+        }
+        mWorkers.reserve(count);
+        mNodes.resize(nodeCpus.size());
+        for (size_t node = 0, remainder = count; node < nodeCpus.size(); ++node) {
+            auto nodeCpuCount = std::max(nodeCpus[node].size(), (size_t)1);
+            auto workerCount = node + 1 < nodeCpus.size() ? std::min(count * nodeCpuCount / cpuCount, remainder) : remainder;
+            remainder -= workerCount;
+            mNodes[node].workerBegin = mWorkers.size();
+            mNodes[node].workerCount = workerCount;
+            for (size_t i = 0; i < workerCount; ++i) {
+                mWorkers.push_back(std::make_unique<Worker>());
+                auto& worker = *mWorkers.back();
+                worker.pThreadPool = this;
+                worker.index = mWorkers.size() - 1;
+                worker.node = node;
+                if (createInfo.affinity == Affinity::Core && !nodeCpus[node].empty()) {
+                    worker.cpus.push_back(nodeCpus[node][i % nodeCpus[node].size()]);
+                } else if (createInfo.affinity == Affinity::Node) {
+                    worker.cpus = nodeCpus[node];
                 }
-            );
+            }
+        }
+        if (threaded) {
+            resize(threadCount);
         }
     }
 
     /**
     Destroys this instance of ThreadPool
+        @note Pending tasks are processed before this ThreadPool object's threads are joined
+        @note If this ThreadPool uses Execution::Deferred pending tasks are processed on the calling thread
+        @note Pending timers are discarded
     */
     inline ~ThreadPool()
     {
-        mActive = false;
+        mTimerMutex.lock();
+        mTimersActive = false;
+        mTimerMutex.unlock();
+        mTimerCondition.notify_one();
+        if (mTimerThread.joinable()) {
+            mTimerThread.join();
+        }
+        if (mExecution == Execution::Deferred) {
+            while (process_pending_task()) {
+            }
+        }
+        {
+            // NOTE : mActive is cleared with mResizeMutex locked so grow() and resize()
+            //  can't start a thread in a slot the loop below has already joined.
+            std::lock_guard<std::mutex> resizeLock(mResizeMutex);
+            std::lock_guard<std::mutex> lock(mMutex);
+            mActive = false;
+        }
         mTaskReceived.notify_all();
-        for (auto& thread : mThreads) {
-            if (thread.joinable()) {
-                thread.join();
+        for (auto& upWorker : mWorkers) {
+            if (upWorker->thread.joinable()) {
+                upWorker->thread.join();
             }
         }
     }
@@ -78,7 +467,68 @@ public:
     */
     inline size_t get_thread_count() const
     {
-        return mThreads.size();
+        return mThreadCount;
+    }
+
+    /**
+    Gets this ThreadPool object's maximum number of threads
+    */
+    inline size_t get_max_thread_count() const
+    {
+        return mExecution == Execution::Threaded ? mWorkers.size() : 0;
+    }
+
+    /**
+    Gets this ThreadPool object's Execution
+    */
+    inline Execution get_execution() const
+    {
+        return mExecution;
+    }
+
+    /**
+    Sets this ThreadPool object's number of threads
+    @param [in] count This ThreadPool object's number of threads
+        @note count is clamped to [1, get_max_thread_count()]
+        @note count becomes the minimum number of threads elastic growth and retirement operate above
+        @note Stopped threads process the tasks already queued on their queues before exiting, this method doesn't wait for them to exit
+        @note This method may be called from this ThreadPool object's threads
+        @note This method has no effect if this ThreadPool doesn't use Execution::Threaded
+        @note This method has no effect once this ThreadPool is being destroyed
+    */
+    inline void resize(size_t count)
+    {
+        if (mExecution != Execution::Threaded) {
+            return;
+        }
+        std::lock_guard<std::mutex> lock(mResizeMutex);
+        if (!mActive) {
+            return;
+        }
+        count = std::min(std::max(count, (size_t)1), mWorkers.size());
+        auto threadCount = mThreadCount.load();
+        for (size_t i = count; i < threadCount; ++i) {
+            mWorkers[i]->stopRequested = true;
+        }
+        for (size_t i = threadCount; i < count; ++i) {
+            start_worker(*mWorkers[i]);
+        }
+        mThreadCount = count;
+        mMinThreadCount = count;
+        if (count < threadCount) {
+            mMutex.lock();
+            mMutex.unlock();
+            mTaskReceived.notify_all();
+        }
+    }
+
+    /**
+    Gets this ThreadPool object's number of nodes
+        @note This ThreadPool has a single node unless it was created with an Affinity other than Affinity::None
+    */
+    inline size_t get_node_count() const
+    {
+        return mNodes.size();
     }
 
     /**
@@ -96,72 +546,1344 @@ public:
     */
     inline size_t get_task_count() const
     {
-        return mTasks.size();
+        return mTaskCount;
+    }
+
+    /**
+    Gets a snapshot of this ThreadPool object's Statistics
+    @return A snapshot of this ThreadPool object's Statistics
+        @note Counters are read without locking while they're being updated, each counter is consistent but the snapshot as a whole isn't
+        @note Counters are cumulative from this ThreadPool object's creation, poll periodically and compare snapshots to get rates
+    */
+    inline Statistics get_statistics() const
+    {
+        Statistics statistics { };
+        statistics.threads.reserve(mWorkers.size());
+        for (const auto& upWorker : mWorkers) {
+            statistics.threads.push_back(upWorker->counters.get_thread_statistics(statistics.latencyHistogram));
+        }
+        statistics.otherThreads = mOtherThreadCounters.get_thread_statistics(statistics.latencyHistogram);
+        return statistics;
+    }
+
+    /**
+    Queues a task for processing on one of this ThreadPool object's threads
+    @param <TaskType> The type of task to queue for processing
+    @param [in] task The task to queue for processing
+    @return A Future<> that can be used to get the given task's result
+        @note Equivalent to push(task, PushInfo { })
+    */
+    template <typename TaskType>
+    inline Future<typename std::invoke_result<TaskType&>::type> push(TaskType task)
+    {
+        return push(std::move(task), PushInfo { });
     }
 
     /**
     Queues a task for processing on one of this ThreadPool object's threads
     @param <TaskType> The type of task to queue for processing
     @param [in] task The task to queue for processing
-    @return A std::future<void()> that can be used for notification of completion of the given task
-        @note TaskType must have a signature compatible with std::packaged_task<void()>
+    @param [in] pushInfo The PushInfo to use to queue the given task
+    @return A Future<> that can be used to get the given task's result
+        @note TaskType must be callable with no arguments, its return type is the returned Future<> object's result type
+        @note If the given task throws, the exception is rethrown by Future<>::get()
+        @note If pushInfo.cancellationToken is cancelled before the given task is dequeued, the task is dropped and Future<>::get() throws std::future_error with std::future_errc::broken_promise
+        @note If this method is called from one of this ThreadPool object's threads the task is queued on that thread's queue
     */
     template <typename TaskType>
-    inline std::future<void> push(TaskType task)
-    {
-        std::packaged_task<void()> packagedTask(std::move(task));
-        auto future = packagedTask.get_future();
-        mMutex.lock();
-        mTasks.push(std::move(packagedTask));
-        mMutex.unlock();
-        mTaskReceived.notify_one();
+    inline Future<typename std::invoke_result<TaskType&>::type> push(TaskType task, const PushInfo& pushInfo)
+    {
+        using ResultType = typename std::invoke_result<TaskType&>::type;
+        auto spState = std::make_shared<detail::FutureState<ResultType>>();
+        Future<ResultType> future(*this, spState);
+        push_detached(FutureTask<ResultType, TaskType>(*this, std::move(spState), std::move(task)), pushInfo);
         return future;
     }
 
     /**
-    TODO : Documentation
+    Queues a task for processing on one of this ThreadPool object's threads without providing notification of completion
+    @param <TaskType> The type of task to queue for processing
+    @param [in] task The task to queue for processing
+        @note Equivalent to push_detached(task, PushInfo { })
     */
-    inline void clear()
+    template <typename TaskType>
+    inline void push_detached(TaskType task)
+    {
+        push_detached(std::move(task), PushInfo { });
+    }
+
+    /**
+    Queues a task for processing on one of this ThreadPool object's threads without providing notification of completion
+    @param <TaskType> The type of task to queue for processing
+    @param [in] task The task to queue for processing
+    @param [in] pushInfo The PushInfo to use to queue the given task
+        @note TaskType must have a signature compatible with void()
+        @note TaskType objects that are nothrow move constructible and fit in TaskCapacity bytes are queued without allocating
+        @note Exceptions thrown by the given task will call std::terminate()
+        @note If this method is called from one of this ThreadPool object's threads the task is queued on that thread's queue
+        @note If this ThreadPool uses Execution::Immediate the task is processed before this method returns
+    */
+    template <typename TaskType>
+    inline void push_detached(TaskType task, const PushInfo& pushInfo)
+    {
+        auto pTask = allocate_tasks(1);
+        assign_task(*pTask, std::move(task));
+        enqueue_tasks(pTask, 1, pushInfo);
+    }
+
+    /**
+    Queues a range of tasks for processing on this ThreadPool object's threads
+    @param <IteratorType> The type of iterator used to traverse the range of tasks to queue for processing
+    @param [in] begin An iterator to the beginning of the range of tasks to queue for processing
+    @param [in] end An iterator to the end of the range of tasks to queue for processing
+    @return A Future<void> that can be used for notification of completion of all tasks in the given range
+        @note Equivalent to push_batch(begin, end, PushInfo { })
+    */
+    template <typename IteratorType>
+    inline Future<void> push_batch(IteratorType begin, IteratorType end)
+    {
+        return push_batch(begin, end, PushInfo { });
+    }
+
+    /**
+    Queues a range of tasks for processing on this ThreadPool object's threads
+    @param <IteratorType> The type of iterator used to traverse the range of tasks to queue for processing
+    @param [in] begin An iterator to the beginning of the range of tasks to queue for processing
+    @param [in] end An iterator to the end of the range of tasks to queue for processing
+    @param [in] pushInfo The PushInfo to use to queue the given tasks
+    @return A Future<void> that can be used for notification of completion of all tasks in the given range
+        @note Tasks in the given range must have a signature compatible with void() and are moved from
+        @note Each of this ThreadPool object's task queues is locked at most once and at most as many threads are woken as tasks are queued
+        @note If any task throws, the returned Future<void> reports the first exception thrown after all tasks have completed
+    */
+    template <typename IteratorType>
+    inline Future<void> push_batch(IteratorType begin, IteratorType end, const PushInfo& pushInfo)
     {
-        std::lock_guard<std::mutex> lock(mMutex);
-        while (!mTasks.empty()) {
-            auto task = std::move(mTasks.front());
-            mTasks.pop();
+        using TaskType = typename std::iterator_traits<IteratorType>::value_type;
+        auto count = (size_t)std::distance(begin, end);
+        auto pBatch = new Batch<std::nullptr_t>(*this, count);
+        Future<void> future(*this, pBatch->spState);
+        if (count) {
+            auto pTasks = allocate_tasks(count);
+            auto pTask = pTasks;
+            for (auto itr = begin; itr != end; ++itr) {
+                assign_task(*pTask, BatchTask<Batch<std::nullptr_t>, TaskType>(pBatch, TaskType(std::move(*itr))));
+                pTask = pTask->pNext;
+            }
+            enqueue_tasks(pTasks, count, pushInfo);
+        } else {
+            pBatch->complete();
         }
+        return future;
     }
 
     /**
-    Suspends the calling thread until this ThreadPool has completed all pending tasks
+    Queues a task for processing a specified number of times on this ThreadPool object's threads
+    @param <TaskType> The type of task to queue for processing
+    @param [in] count The number of times to process the given task
+    @param [in] task The task to queue for processing
+    @return A Future<void> that can be used for notification of completion of all invocations of the given task
+        @note Equivalent to push_batch(count, task, PushInfo { })
     */
-    inline void wait()
+    template <typename TaskType>
+    inline Future<void> push_batch(size_t count, TaskType task)
     {
-        std::unique_lock<std::mutex> lock(mMutex);
-        mTasksComplete.wait(lock, [&]() { return !mActiveThreadCount && mTasks.empty(); });
+        return push_batch(count, std::move(task), PushInfo { });
     }
 
-private:
-    std::packaged_task<void()> get_task()
+    /**
+    Queues a task for processing a specified number of times on this ThreadPool object's threads
+    @param <TaskType> The type of task to queue for processing
+    @param [in] count The number of times to process the given task
+    @param [in] task The task to queue for processing
+    @param [in] pushInfo The PushInfo to use to queue the given task
+    @return A Future<void> that can be used for notification of completion of all invocations of the given task
+        @note TaskType must have a signature compatible with void(size_t), it's called with each index in [0, count)
+        @note The given task is shared by all invocations and may be called concurrently
+        @note Each of this ThreadPool object's task queues is locked at most once and at most as many threads are woken as tasks are queued
+        @note If any invocation throws, the returned Future<void> reports the first exception thrown after all invocations have completed
+    */
+    template <typename TaskType>
+    inline Future<void> push_batch(size_t count, TaskType task, const PushInfo& pushInfo)
     {
-        std::lock_guard<std::mutex> lock(mMutex);
-        if (!mTasks.empty()) {
-            auto task = std::move(mTasks.front());
-            mTasks.pop();
-            return task;
+        auto pBatch = new Batch<TaskType>(*this, count, std::move(task));
+        Future<void> future(*this, pBatch->spState);
+        if (count) {
+            auto pTasks = allocate_tasks(count);
+            auto pTask = pTasks;
+            for (size_t i = 0; i < count; ++i) {
+                auto batchTask = [pBatch, i]() { pBatch->task(i); };
+                assign_task(*pTask, BatchTask<Batch<TaskType>, decltype(batchTask)>(pBatch, batchTask));
+                pTask = pTask->pNext;
+            }
+            enqueue_tasks(pTasks, count, pushInfo);
+        } else {
+            pBatch->complete();
         }
-        return { };
+        return future;
     }
 
-    std::atomic_bool mActive { true };
-    std::vector<std::thread> mThreads;
-    std::atomic_size_t mActiveThreadCount { 0 };
-    std::queue<std::packaged_task<void()>> mTasks;
-    std::mutex mMutex;
-    std::condition_variable mTaskReceived;
-    std::condition_variable mTasksComplete;
-    ThreadPool(const ThreadPool&) = delete;
-    ThreadPool(ThreadPool&&) = delete;
-    ThreadPool& operator=(const ThreadPool&) = delete;
-    ThreadPool& operator=(ThreadPool&&) = delete;
-};
+    /**
+    Queues a task for processing on one of this ThreadPool object's threads after a specified delay
+    @param <DurationType> The type of duration used to specify the delay
+    @param <TaskType> The type of task to queue for processing
+    @param [in] delay The time to wait before queueing the given task
+    @param [in] task The task to queue for processing
+    @return The TimerId of the created timer, which can be passed to cancel_timer()
+        @note Equivalent to push_after(delay, task, PushInfo { })
+    */
+    template <typename DurationType, typename TaskType>
+    inline TimerId push_after(const DurationType& delay, TaskType task)
+    {
+        return push_after(delay, std::move(task), PushInfo { });
+    }
+
+    /**
+    Queues a task for processing on one of this ThreadPool object's threads after a specified delay
+    @param <DurationType> The type of duration used to specify the delay
+    @param <TaskType> The type of task to queue for processing
+    @param [in] delay The time to wait before queueing the given task
+    @param [in] task The task to queue for processing
+    @param [in] pushInfo The PushInfo to use to queue the given task
+    @return The TimerId of the created timer, which can be passed to cancel_timer()
+        @note DurationType must be a std::chrono::duration<>, ie. Milliseconds<> or Seconds<>
+        @note TaskType must have a signature compatible with void(), exceptions thrown by the given task will call std::terminate()
+        @note The given task is queued on the first tick of TimerResolution at or after the delay has elapsed, it's never queued early
+        @note Timers that haven't fired when this ThreadPool is destroyed are discarded
+    */
+    template <typename DurationType, typename TaskType>
+    inline TimerId push_after(const DurationType& delay, TaskType task, const PushInfo& pushInfo)
+    {
+        Timer timer { };
+        assign_task(timer.function, std::move(task));
+        timer.pushInfo = pushInfo;
+        return add_timer(duration_cast<SteadyClock::duration>(delay), std::move(timer));
+    }
+
+    /**
+    Queues a task for processing on one of this ThreadPool object's threads repeatedly with a specified period
+    @param <DurationType> The type of duration used to specify the period
+    @param <TaskType> The type of task to queue for processing
+    @param [in] period The time between each time the given task is queued
+    @param [in] task The task to queue for processing
+    @return The TimerId of the created timer, which can be passed to cancel_timer()
+        @note Equivalent to push_every(period, task, PushInfo { })
+    */
+    template <typename DurationType, typename TaskType>
+    inline TimerId push_every(const DurationType& period, TaskType task)
+    {
+        return push_every(period, std::move(task), PushInfo { });
+    }
+
+    /**
+    Queues a task for processing on one of this ThreadPool object's threads repeatedly with a specified period
+    @param <DurationType> The type of duration used to specify the period
+    @param <TaskType> The type of task to queue for processing
+    @param [in] period The time between each time the given task is queued
+    @param [in] task The task to queue for processing
+    @param [in] pushInfo The PushInfo to use to queue the given task
+    @return The TimerId of the created timer, which can be passed to cancel_timer()
+        @note DurationType must be a std::chrono::duration<>, ie. Milliseconds<> or Seconds<>
+        @note TaskType must have a signature compatible with void(), exceptions thrown by the given task will call std::terminate()
+        @note The given task is first queued one period from now, periods are rounded up to TimerResolution and don't drift, periods missed because the timer thread fell behind are skipped
+        @note The given task is shared by every firing and may be processed concurrently if it takes longer than the period
+        @note The given task is queued until cancel_timer() is called, pushInfo.cancellationToken is cancelled, or this ThreadPool is destroyed
+    */
+    template <typename DurationType, typename TaskType>
+    inline TimerId push_every(const DurationType& period, TaskType task, const PushInfo& pushInfo)
+    {
+        auto timerPeriod = duration_cast<SteadyClock::duration>(period);
+        Timer timer { };
+        timer.spFunction = std::make_shared<TaskFunction>();
+        assign_task(*timer.spFunction, std::move(task));
+        timer.periodTickCount = std::max(get_timer_tick_count(timerPeriod), (uint64_t)1);
+        timer.pushInfo = pushInfo;
+        return add_timer(timerPeriod, std::move(timer));
+    }
+
+    /**
+    Cancels a timer created with push_after() or push_every()
+    @param [in] timerId The TimerId of the timer to cancel
+    @return Whether or not the timer was pending, false if the timer already fired or was cancelled
+        @note Tasks that a timer already queued are unaffected
+    */
+    inline bool cancel_timer(TimerId timerId)
+    {
+        std::lock_guard<std::mutex> lock(mTimerMutex);
+        return mTimerWheel.erase(timerId);
+    }
+
+    /**
+    Gets this ThreadPool object's number of pending timers
+        @note The value retuned by this method may be stale by the time it's read
+    */
+    inline size_t get_timer_count() const
+    {
+        std::lock_guard<std::mutex> lock(mTimerMutex);
+        return mTimerWheel.size();
+    }
+
+    #if defined(DYNAMIC_STATIC_COROUTINES_ENABLED)
+    /**
+    Awaitable that resumes the awaiting coroutine on one of a ThreadPool object's threads
+    */
+    class ScheduleOperation final
+    {
+    public:
+        /**
+        Gets a value indicating whether or not the awaiting coroutine can continue without suspending
+        @return false, the awaiting coroutine always suspends
+        */
+        inline bool await_ready() const noexcept
+        {
+            return false;
+        }
+
+        /**
+        Queues the resumption of the awaiting coroutine on this ScheduleOperation object's ThreadPool
+        @param [in] handle The awaiting coroutine's handle
+        */
+        inline void await_suspend(std::coroutine_handle<> handle)
+        {
+            mpThreadPool->push_detached([handle]() { handle.resume(); }, mPushInfo);
+        }
+
+        /**
+        Called when the awaiting coroutine is resumed
+        */
+        inline void await_resume() const noexcept
+        {
+        }
+
+    private:
+        inline ScheduleOperation(ThreadPool& threadPool, const PushInfo& pushInfo)
+            : mpThreadPool { &threadPool }
+            , mPushInfo { pushInfo }
+        {
+        }
+
+        ThreadPool* mpThreadPool { nullptr };
+        PushInfo mPushInfo { };
+        friend class ThreadPool;
+    };
+
+    /**
+    Gets an awaitable that resumes the awaiting coroutine on one of this ThreadPool object's threads
+    @return The awaitable ScheduleOperation
+        @note Equivalent to schedule(PushInfo { })
+    */
+    inline ScheduleOperation schedule()
+    {
+        return schedule(PushInfo { });
+    }
+
+    /**
+    Gets an awaitable that resumes the awaiting coroutine on one of this ThreadPool object's threads
+    @param [in] pushInfo The PushInfo to use to queue the awaiting coroutine's resumption
+    @return The awaitable ScheduleOperation
+        @note The awaiting coroutine's resumption is queued like any other task, if it's removed by clear() the awaiting coroutine is never resumed
+    */
+    inline ScheduleOperation schedule(const PushInfo& pushInfo)
+    {
+        return ScheduleOperation(*this, pushInfo);
+    }
+    #endif // DYNAMIC_STATIC_COROUTINES_ENABLED
+
+    /**
+    Gets the CancellationToken of the task being processed on the calling thread
+    @return The PushInfo::cancellationToken of the task being processed on the calling thread, or a CancellationToken that's never cancelled if the calling thread isn't processing a task
+        @note Long running tasks can poll the returned CancellationToken and return early when cancellation is requested
+    */
+    inline static CancellationToken get_current_cancellation_token()
+    {
+        auto pCancellationToken = get_current_task_cancellation_token();
+        return pCancellationToken ? *pCancellationToken : CancellationToken { };
+    }
+
+    /**
+    Removes all pending tasks from this ThreadPool
+        @note Tasks that are currently being processed are unaffected
+        @note Future<> objects associated with removed tasks will report std::future_errc::broken_promise
+    */
+    inline void clear()
+    {
+        std::deque<Task*> tasks;
+        for (auto& upWorker : mWorkers) {
+            for (size_t priority = 0; priority < PriorityCount; ++priority) {
+                auto& queue = upWorker->queues[priority];
+                upWorker->mutex.lock();
+                tasks.swap(queue.tasks);
+                queue.taskCount = 0;
+                upWorker->mutex.unlock();
+                if (!tasks.empty()) {
+                    for (auto pTask : tasks) {
+                        free_task(pTask);
+                    }
+                    mTaskCounts[priority] -= tasks.size();
+                    mTaskCount -= tasks.size();
+                    complete_tasks(tasks.size());
+                    tasks.clear();
+                }
+            }
+        }
+    }
+
+    /**
+    Processes one pending task on the calling thread if one is available
+    @return Whether or not a pending task was processed
+        @note If this method is called from one of this ThreadPool object's threads that thread's queue is checked first
+    */
+    inline bool process_pending_task()
+    {
+        Task* pTask = nullptr;
+        auto pWorker = get_current_worker();
+        if (pWorker && pWorker->pThreadPool == this) {
+            pTask = get_task(pWorker);
+        } else if (mTaskCount.load(std::memory_order_relaxed)) {
+            pTask = get_task(nullptr);
+        }
+        if (pTask) {
+            execute_task(pTask, pWorker && pWorker->pThreadPool == this ? pWorker->counters : mOtherThreadCounters);
+        }
+        return pTask != nullptr;
+    }
+
+    /**
+    Processes pending tasks on the calling thread until a given predicate is satisfied
+    @param <PredicateType> The type of predicate to check
+    @param [in] predicate The predicate to check
+        @note PredicateType must have a signature compatible with bool()
+        @note When there are no pending tasks to process the calling thread idles according to this ThreadPool object's CreateInfo then blocks until a task is pushed or notify_waiters() is called
+        @note Whatever makes the given predicate true must call notify_waiters() afterwards
+        @note This method may be called from this ThreadPool object's threads
+    */
+    template <typename PredicateType>
+    inline void process_pending_tasks_until(PredicateType predicate)
+    {
+        while (!predicate()) {
+            if (!process_pending_task() && !idle(predicate)) {
+                std::unique_lock<std::mutex> lock(mMutex);
+                ++mSleepingThreadCount;
+                ++mWaitingThreadCount;
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                mTaskReceived.wait(lock, [&]() { return mTaskCount || predicate(); });
+                --mWaitingThreadCount;
+                --mSleepingThreadCount;
+            }
+        }
+    }
+
+    /**
+    Wakes threads blocked in process_pending_tasks_until() so that they check their predicates
+        @note This method is cheap when no threads are blocked in process_pending_tasks_until()
+    */
+    inline void notify_waiters()
+    {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (mWaitingThreadCount) {
+            mMutex.lock();
+            mMutex.unlock();
+            mTaskReceived.notify_all();
+        }
+    }
+
+    /**
+    Suspends the calling thread until this ThreadPool has completed all pending tasks
+        @note Calling this method from one of this ThreadPool object's threads will dead lock
+        @note If this ThreadPool uses Execution::Deferred pending tasks are processed on the calling thread
+    */
+    inline void wait()
+    {
+        if (mExecution == Execution::Deferred) {
+            process_pending_tasks_until([&]() { return !mIncompleteTaskCount; });
+        } else {
+            std::unique_lock<std::mutex> lock(mMutex);
+            mTasksComplete.wait(lock, [&]() { return !mIncompleteTaskCount; });
+        }
+    }
+
+private:
+    static constexpr size_t TaskBlockSize { 256 };
+    static constexpr size_t PriorityCount { (size_t)Priority::Count };
+    using TaskFunction = InlineFunction<void(), TaskCapacity>;
+
+    struct Task final
+    {
+        TaskFunction function;
+        Task* pNext { nullptr };
+        SteadyClock::time_point enqueueTime { };
+        CancellationToken cancellationToken;
+    };
+
+    struct Timer final
+    {
+        TaskFunction function;
+        std::shared_ptr<TaskFunction> spFunction;
+        uint64_t periodTickCount { 0 };
+        PushInfo pushInfo { };
+    };
+
+    struct Counters final
+    {
+        // NOTE : Each ThreadPool thread's Counters are only written by that thread
+        //  (queueHighWaterMark is written with its queue's mutex locked) so they're
+        //  updated with plain loads and stores, shared Counters use fetch_add().
+        inline Counters(bool shared = false)
+            : shared { shared }
+        {
+        }
+
+        inline void add(std::atomic_uint64_t& counter, uint64_t value)
+        {
+            if (shared) {
+                counter.fetch_add(value, std::memory_order_relaxed);
+            } else {
+                counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+            }
+        }
+
+        inline void add(std::atomic_uint64_t& counter, SteadyClock::duration duration)
+        {
+            add(counter, (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count());
+        }
+
+        inline void add_latency(SteadyClock::duration latency)
+        {
+            size_t bucket = 0;
+            auto nanoseconds = (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(latency).count();
+            while (nanoseconds > 1 && bucket < LatencyHistogramBucketCount - 1) {
+                nanoseconds >>= 1;
+                ++bucket;
+            }
+            add(latencyHistogram[bucket], 1);
+        }
+
+        inline ThreadStatistics get_thread_statistics(std::array<uint64_t, LatencyHistogramBucketCount>& histogram) const
+        {
+            ThreadStatistics threadStatistics { };
+            threadStatistics.executedTaskCount = executedTaskCount.load(std::memory_order_relaxed);
+            threadStatistics.stolenTaskCount = stolenTaskCount.load(std::memory_order_relaxed);
+            threadStatistics.cancelledTaskCount = cancelledTaskCount.load(std::memory_order_relaxed);
+            threadStatistics.queueHighWaterMark = queueHighWaterMark.load(std::memory_order_relaxed);
+            threadStatistics.busyDuration = Nanoseconds<>((double)busyNanoseconds.load(std::memory_order_relaxed));
+            threadStatistics.spinDuration = Nanoseconds<>((double)spinNanoseconds.load(std::memory_order_relaxed));
+            threadStatistics.idleDuration = Nanoseconds<>((double)idleNanoseconds.load(std::memory_order_relaxed));
+            for (size_t i = 0; i < LatencyHistogramBucketCount; ++i) {
+                histogram[i] += latencyHistogram[i].load(std::memory_order_relaxed);
+            }
+            return threadStatistics;
+        }
+
+        const bool shared { false };
+        std::atomic_uint64_t executedTaskCount { 0 };
+        std::atomic_uint64_t stolenTaskCount { 0 };
+        std::atomic_uint64_t cancelledTaskCount { 0 };
+        std::atomic_uint64_t queueHighWaterMark { 0 };
+        std::atomic_uint64_t busyNanoseconds { 0 };
+        std::atomic_uint64_t spinNanoseconds { 0 };
+        std::atomic_uint64_t idleNanoseconds { 0 };
+        std::atomic_uint64_t latencyHistogram[LatencyHistogramBucketCount] { };
+    };
+
+    template <typename ResultType, typename TaskType>
+    struct FutureTask final
+    {
+        // NOTE : A FutureTask that's destroyed without being processed, ie. by clear(),
+        //  reports std::future_errc::broken_promise so its Future<> doesn't wait forever.
+        inline FutureTask(ThreadPool& threadPool, std::shared_ptr<detail::FutureState<ResultType>> spState, TaskType task)
+            : pThreadPool { &threadPool }
+            , spState { std::move(spState) }
+            , task(std::move(task))
+        {
+        }
+
+        FutureTask(FutureTask&& other) = default;
+
+        inline ~FutureTask()
+        {
+            if (spState) {
+                spState->set_exception(std::make_exception_ptr(std::future_error(std::future_errc::broken_promise)));
+                pThreadPool->notify_waiters();
+            }
+        }
+
+        inline void operator()()
+        {
+            auto spState = std::move(this->spState);
+            spState->run(task);
+            pThreadPool->notify_waiters();
+        }
+
+        ThreadPool* pThreadPool { nullptr };
+        std::shared_ptr<detail::FutureState<ResultType>> spState;
+        TaskType task;
+    };
+
+    template <typename TaskType>
+    struct Batch final
+    {
+        template <typename ...Args>
+        inline Batch(ThreadPool& threadPool, size_t count, Args&&... args)
+            : pThreadPool { &threadPool }
+            , taskCount { count }
+            , spState { std::make_shared<detail::FutureState<void>>() }
+            , task(std::forward<Args>(args)...)
+        {
+        }
+
+        template <typename BatchTaskType>
+        inline void process(BatchTaskType& batchTask)
+        {
+            try {
+                batchTask();
+            } catch (...) {
+                capture_exception(std::current_exception());
+            }
+            release();
+        }
+
+        inline void abandon()
+        {
+            capture_exception(std::make_exception_ptr(std::future_error(std::future_errc::broken_promise)));
+            release();
+        }
+
+        inline void capture_exception(std::exception_ptr exception)
+        {
+            if (!exceptionCaptured.test_and_set()) {
+                this->exception = std::move(exception);
+            }
+        }
+
+        inline void release()
+        {
+            if (taskCount.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                complete();
+            }
+        }
+
+        inline void complete()
+        {
+            auto& threadPool = *pThreadPool;
+            auto spState = std::move(this->spState);
+            if (exception) {
+                spState->set_exception(exception);
+            } else {
+                auto setValue = []() { };
+                spState->run(setValue);
+            }
+            delete this;
+            threadPool.notify_waiters();
+        }
+
+        ThreadPool* pThreadPool { nullptr };
+        std::atomic_size_t taskCount { 0 };
+        std::shared_ptr<detail::FutureState<void>> spState;
+        std::exception_ptr exception;
+        std::atomic_flag exceptionCaptured = ATOMIC_FLAG_INIT;
+        TaskType task;
+    };
+
+    template <typename BatchType, typename TaskType>
+    struct BatchTask final
+    {
+        // NOTE : A BatchTask that's destroyed without being processed, ie. by clear(),
+        //  still releases its Batch so the Batch completes with std::future_errc::broken_promise.
+        inline BatchTask(BatchType* pBatch, TaskType task)
+            : pBatch { pBatch }
+            , task(std::move(task))
+        {
+        }
+
+        inline BatchTask(BatchTask&& other) noexcept(std::is_nothrow_move_constructible<TaskType>::value)
+            : pBatch { std::exchange(other.pBatch, nullptr) }
+            , task(std::move(other.task))
+        {
+        }
+
+        inline ~BatchTask()
+        {
+            if (pBatch) {
+                pBatch->abandon();
+            }
+        }
+
+        inline void operator()()
+        {
+            std::exchange(pBatch, nullptr)->process(task);
+        }
+
+        BatchType* pBatch { nullptr };
+        TaskType task;
+    };
+
+    struct alignas(64) Worker final
+    {
+        ThreadPool* pThreadPool { nullptr };
+        size_t index { 0 };
+        size_t node { 0 };
+        std::vector<size_t> cpus;
+        std::atomic_bool stopRequested { false };
+        bool exited { false };
+        std::thread thread;
+        std::mutex mutex;
+        struct Queue final
+        {
+            std::deque<Task*> tasks;
+            std::atomic_size_t taskCount { 0 };
+        } queues[PriorityCount];
+        size_t processedTaskCount { 0 };
+        Task* pFreeTasks { nullptr };
+        size_t freeTaskCount { 0 };
+        Counters counters;
+    };
+
+    static CreateInfo make_create_info(size_t threadCount)
+    {
+        CreateInfo createInfo { };
+        createInfo.threadCount = threadCount;
+        return createInfo;
+    }
+
+    struct Node final
+    {
+        size_t workerBegin { 0 };
+        size_t workerCount { 0 };
+    };
+
+    static std::vector<std::vector<size_t>> get_node_cpus(const std::vector<size_t>& cpus)
+    {
+        // NOTE : Each node's cpulist is a comma separated list of CPUs and ranges of
+        //  CPUs, ie. "0-3,8-11".  CPUs the process can't run on are skipped.
+        std::vector<std::vector<size_t>> nodeCpus;
+        #if defined(DYNAMIC_STATIC_PLATFORM_LINUX)
+        cpu_set_t cpuSet;
+        CPU_ZERO(&cpuSet);
+        if (!sched_getaffinity(0, sizeof(cpuSet), &cpuSet)) {
+            auto is_available = [&](size_t cpu)
+            {
+                return
+                    cpu < CPU_SETSIZE && CPU_ISSET(cpu, &cpuSet) &&
+                    (cpus.empty() || std::find(cpus.begin(), cpus.end(), cpu) != cpus.end());
+            };
+            for (size_t node = 0; ; ++node) {
+                std::ifstream file("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist");
+                if (!file.is_open()) {
+                    break;
+                }
+                std::vector<size_t> availableCpus;
+                std::string range;
+                while (std::getline(file, range, ',')) {
+                    size_t first = 0;
+                    size_t last = 0;
+                    auto separator = range.find('-');
+                    try {
+                        first = std::stoul(range);
+                        last = separator != std::string::npos ? std::stoul(range.substr(separator + 1)) : first;
+                    } catch (...) {
+                        continue;
+                    }
+                    for (auto cpu = first; cpu <= last; ++cpu) {
+                        if (is_available(cpu)) {
+                            availableCpus.push_back(cpu);
+                        }
+                    }
+                }
+                if (!availableCpus.empty()) {
+                    nodeCpus.push_back(std::move(availableCpus));
+                }
+            }
+            if (nodeCpus.empty()) {
+                nodeCpus.emplace_back();
+                for (size_t cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+                    if (is_available(cpu)) {
+                        nodeCpus.back().push_back(cpu);
+                    }
+                }
+            }
+        }
+        #else
+        (void)cpus;
+        #endif
+        return nodeCpus;
+    }
+
+    static void set_affinity(const Worker& worker)
+    {
+        #if defined(DYNAMIC_STATIC_PLATFORM_LINUX)
+        if (!worker.cpus.empty()) {
+            cpu_set_t cpuSet;
+            CPU_ZERO(&cpuSet);
+            for (auto cpu : worker.cpus) {
+                CPU_SET(cpu, &cpuSet);
+            }
+            pthread_setaffinity_np(pthread_self(), sizeof(cpuSet), &cpuSet);
+        }
+        #else
+        (void)worker;
+        #endif
+    }
+
+    static Worker*& get_current_worker()
+    {
+        static thread_local Worker* tlpWorker { nullptr };
+        return tlpWorker;
+    }
+
+    static const CancellationToken*& get_current_task_cancellation_token()
+    {
+        static thread_local const CancellationToken* tlpCancellationToken { nullptr };
+        return tlpCancellationToken;
+    }
+
+    Task* allocate_tasks(size_t count)
+    {
+        Task* pTasks = nullptr;
+        auto pWorker = get_current_worker();
+        if (pWorker && pWorker->pThreadPool == this) {
+            for (; count && pWorker->pFreeTasks; --count) {
+                auto pTask = pWorker->pFreeTasks;
+                pWorker->pFreeTasks = pTask->pNext;
+                --pWorker->freeTaskCount;
+                pTask->pNext = pTasks;
+                pTasks = pTask;
+            }
+        }
+        if (count) {
+            std::lock_guard<std::mutex> lock(mFreeTaskMutex);
+            for (; count; --count) {
+                if (!mpFreeTasks) {
+                    mTaskBlocks.push_back(std::make_unique<Task[]>(TaskBlockSize));
+                    auto pTaskBlock = mTaskBlocks.back().get();
+                    for (size_t i = 0; i < TaskBlockSize - 1; ++i) {
+                        pTaskBlock[i].pNext = &pTaskBlock[i + 1];
+                    }
+                    mpFreeTasks = pTaskBlock;
+                }
+                auto pTask = mpFreeTasks;
+                mpFreeTasks = pTask->pNext;
+                pTask->pNext = pTasks;
+                pTasks = pTask;
+            }
+        }
+        return pTasks;
+    }
+
+    template <typename TaskType>
+    static void assign_task(Task& task, TaskType&& function)
+    {
+        assign_task(task.function, std::forward<TaskType>(function));
+    }
+
+    template <typename TaskType>
+    static void assign_task(TaskFunction& taskFunction, TaskType&& function)
+    {
+        using FunctionType = typename std::decay<TaskType>::type;
+        if constexpr (TaskFunction::is_storable<FunctionType>()) {
+            taskFunction = std::forward<TaskType>(function);
+        } else {
+            taskFunction = [upFunction = std::make_unique<FunctionType>(std::forward<TaskType>(function))]() { (*upFunction)(); };
+        }
+    }
+
+    void enqueue_tasks(Task* pTasks, size_t count, const PushInfo& pushInfo)
+    {
+        if (pushInfo.cancellationToken.can_be_cancelled()) {
+            for (auto pTask = pTasks; pTask; pTask = pTask->pNext) {
+                pTask->cancellationToken = pushInfo.cancellationToken;
+            }
+        }
+        if (mExecution == Execution::Immediate) {
+            execute_tasks_immediately(pTasks, count);
+            return;
+        }
+        auto priority = std::min((size_t)pushInfo.priority, PriorityCount - 1);
+        mIncompleteTaskCount += count;
+        mTaskCounts[priority] += count;
+        mTaskCount += count;
+        if (mTimingStatisticsEnabled || mGrowLatency.count()) {
+            auto enqueueTime = SteadyClock::now();
+            for (auto pTask = pTasks; pTask; pTask = pTask->pNext) {
+                pTask->enqueueTime = enqueueTime;
+            }
+        }
+        // NOTE : Tasks are only distributed to running threads, threads in slots past
+        //  mThreadCount may be stopping.  Tasks that land on a stopped thread's queue
+        //  are stolen by running threads, which check every slot.  Without threads
+        //  tasks are queued on the single slot and taken by waiting threads.
+        auto threadCount = mExecution == Execution::Threaded ? mThreadCount.load(std::memory_order_relaxed) : mWorkers.size();
+        auto node = pushInfo.node < mNodes.size() && mNodes[pushInfo.node].workerCount && mNodes[pushInfo.node].workerBegin < threadCount ? pushInfo.node : AnyNode;
+        auto pWorker = get_current_worker();
+        if (pWorker && pWorker->pThreadPool == this && (node == AnyNode || node == pWorker->node)) {
+            auto& queue = pWorker->queues[priority];
+            std::lock_guard<std::mutex> lock(pWorker->mutex);
+            while (pTasks) {
+                auto pNext = pTasks->pNext;
+                queue.tasks.push_back(pTasks);
+                pTasks = pNext;
+            }
+            queue.taskCount = queue.tasks.size();
+            update_queue_high_water_mark(*pWorker);
+        } else {
+            auto nodeWorkerBegin = node != AnyNode ? mNodes[node].workerBegin : 0;
+            auto nodeWorkerCount = node != AnyNode ? std::min(mNodes[node].workerCount, threadCount - nodeWorkerBegin) : threadCount;
+            auto workerCount = std::min(count, nodeWorkerCount);
+            auto workerIndex = mPushWorkerIndex.fetch_add(workerCount, std::memory_order_relaxed);
+            for (size_t i = 0; i < workerCount; ++i) {
+                auto& worker = *mWorkers[nodeWorkerBegin + (workerIndex + i) % nodeWorkerCount];
+                auto& queue = worker.queues[priority];
+                auto workerTaskCount = count / workerCount + (i < count % workerCount ? 1 : 0);
+                std::lock_guard<std::mutex> lock(worker.mutex);
+                for (size_t j = 0; j < workerTaskCount; ++j) {
+                    auto pNext = pTasks->pNext;
+                    queue.tasks.push_back(pTasks);
+                    pTasks = pNext;
+                }
+                queue.taskCount = queue.tasks.size();
+                update_queue_high_water_mark(worker);
+            }
+        }
+        auto sleepingThreadCount = mSleepingThreadCount.load();
+        if (sleepingThreadCount) {
+            mMutex.lock();
+            mMutex.unlock();
+            if (sleepingThreadCount <= count) {
+                mTaskReceived.notify_all();
+            } else {
+                for (size_t i = 0; i < count; ++i) {
+                    mTaskReceived.notify_one();
+                }
+            }
+        }
+    }
+
+    void execute_tasks_immediately(Task* pTasks, size_t count) noexcept
+    {
+        mIncompleteTaskCount += count;
+        mTaskCount += count;
+        while (pTasks) {
+            auto pNext = pTasks->pNext;
+            if (mTimingStatisticsEnabled) {
+                pTasks->enqueueTime = SteadyClock::now();
+            }
+            execute_task(pTasks, mOtherThreadCounters);
+            pTasks = pNext;
+        }
+    }
+
+    template <typename DurationType>
+    static uint64_t get_timer_tick_count(const DurationType& duration)
+    {
+        auto resolution = duration_cast<SteadyClock::duration>(TimerResolution).count();
+        auto count = duration_cast<SteadyClock::duration>(duration).count();
+        return count > 0 ? ((uint64_t)count + (uint64_t)resolution - 1) / (uint64_t)resolution : 0;
+    }
+
+    TimerId add_timer(SteadyClock::duration delay, Timer timer)
+    {
+        std::lock_guard<std::mutex> lock(mTimerMutex);
+        if (!mTimerThread.joinable()) {
+            mTimerThread = std::thread([this]() { process_timers(); });
+        }
+        auto tick = get_timer_tick_count(SteadyClock::now() - mTimerEpoch + delay);
+        auto timerId = mTimerWheel.insert(tick, std::move(timer));
+        if (tick < mTimerWakeTick) {
+            mTimerCondition.notify_one();
+        }
+        return timerId;
+    }
+
+    void process_timers()
+    {
+        // NOTE : Expired timers' tasks are queued with mTimerMutex unlocked so that
+        //  tasks processed immediately can create and cancel timers.
+        std::vector<TimerId> expiredIds;
+        std::vector<std::pair<TaskFunction, PushInfo>> tasks;
+        std::unique_lock<std::mutex> lock(mTimerMutex);
+        while (mTimersActive) {
+            auto tick = (uint64_t)((SteadyClock::now() - mTimerEpoch) / duration_cast<SteadyClock::duration>(TimerResolution));
+            mTimerWheel.advance(tick, expiredIds);
+            for (auto timerId : expiredIds) {
+                auto& timer = *mTimerWheel.get(timerId);
+                if (timer.pushInfo.cancellationToken.is_cancelled()) {
+                    mTimerWheel.erase(timerId);
+                } else if (timer.spFunction) {
+                    tasks.emplace_back([spFunction = timer.spFunction]() { (*spFunction)(); }, timer.pushInfo);
+                    mTimerWheel.reschedule(timerId, std::max(mTimerWheel.get_tick(timerId) + timer.periodTickCount, tick + 1));
+                } else {
+                    tasks.emplace_back(std::move(timer.function), timer.pushInfo);
+                    mTimerWheel.erase(timerId);
+                }
+            }
+            expiredIds.clear();
+            if (!tasks.empty()) {
+                lock.unlock();
+                for (auto& task : tasks) {
+                    auto pTask = allocate_tasks(1);
+                    pTask->function = std::move(task.first);
+                    enqueue_tasks(pTask, 1, task.second);
+                }
+                tasks.clear();
+                lock.lock();
+            } else {
+                mTimerWakeTick = mTimerWheel.get_next_tick();
+                if (mTimerWakeTick == TimerWheel<Timer>::InvalidTick) {
+                    mTimerCondition.wait(lock);
+                } else {
+                    mTimerCondition.wait_until(lock, mTimerEpoch + mTimerWakeTick * duration_cast<SteadyClock::duration>(TimerResolution));
+                }
+                mTimerWakeTick = TimerWheel<Timer>::InvalidTick;
+            }
+        }
+    }
+
+    static void update_queue_high_water_mark(Worker& worker)
+    {
+        uint64_t taskCount = 0;
+        for (const auto& queue : worker.queues) {
+            taskCount += queue.tasks.size();
+        }
+        if (worker.counters.queueHighWaterMark.load(std::memory_order_relaxed) < taskCount) {
+            worker.counters.queueHighWaterMark.store(taskCount, std::memory_order_relaxed);
+        }
+    }
+
+    void free_task(Task* pTask)
+    {
+        pTask->function = nullptr;
+        pTask->cancellationToken = { };
+        auto pWorker = get_current_worker();
+        if (pWorker && pWorker->pThreadPool == this) {
+            pTask->pNext = pWorker->pFreeTasks;
+            pWorker->pFreeTasks = pTask;
+            if (++pWorker->freeTaskCount == 2 * TaskBlockSize) {
+                auto pFirst = pWorker->pFreeTasks;
+                auto pLast = pFirst;
+                for (size_t i = 1; i < TaskBlockSize; ++i) {
+                    pLast = pLast->pNext;
+                }
+                pWorker->pFreeTasks = pLast->pNext;
+                pWorker->freeTaskCount -= TaskBlockSize;
+                std::lock_guard<std::mutex> lock(mFreeTaskMutex);
+                pLast->pNext = mpFreeTasks;
+                mpFreeTasks = pFirst;
+            }
+        } else {
+            std::lock_guard<std::mutex> lock(mFreeTaskMutex);
+            pTask->pNext = mpFreeTasks;
+            mpFreeTasks = pTask;
+        }
+    }
+
+    Task* get_task(Worker* pWorker)
+    {
+        // NOTE : Lanes are checked from highest to lowest Priority, every
+        //  StarvationInterval tasks a thread checks from lowest to highest instead.
+        //  Only calls that return a task are counted so idle polling doesn't change
+        //  how often lower Priority lanes are served.
+        auto reverse = pWorker && !((pWorker->processedTaskCount + 1) % StarvationInterval);
+        for (size_t i = 0; i < PriorityCount; ++i) {
+            auto priority = reverse ? PriorityCount - 1 - i : i;
+            if (mTaskCounts[priority].load(std::memory_order_relaxed)) {
+                auto pTask = pWorker ? pop_task(*pWorker, priority) : nullptr;
+                if (!pTask) {
+                    pTask = steal_task(pWorker, priority);
+                    if (pTask && pWorker) {
+                        pWorker->counters.add(pWorker->counters.stolenTaskCount, 1);
+                    }
+                }
+                if (pTask) {
+                    --mTaskCounts[priority];
+                    if (pWorker) {
+                        ++pWorker->processedTaskCount;
+                    }
+                    return pTask;
+                }
+            }
+        }
+        return nullptr;
+    }
+
+    Task* pop_task(Worker& worker, size_t priority)
+    {
+        Task* pTask = nullptr;
+        auto& queue = worker.queues[priority];
+        if (queue.taskCount.load(std::memory_order_relaxed)) {
+            std::lock_guard<std::mutex> lock(worker.mutex);
+            if (!queue.tasks.empty()) {
+                pTask = queue.tasks.front();
+                queue.tasks.pop_front();
+                queue.taskCount = queue.tasks.size();
+            }
+        }
+        return pTask;
+    }
+
+    Task* steal_task(Worker* pWorker, size_t priority)
+    {
+        // NOTE : ThreadPool threads steal from threads on their own node first, then
+        //  from every thread starting after their own node.
+        Task* pTask = nullptr;
+        if (pWorker) {
+            const auto& node = mNodes[pWorker->node];
+            pTask = steal_task(node.workerBegin, node.workerCount, pWorker->index - node.workerBegin + 1, priority);
+            if (!pTask && node.workerCount < mWorkers.size()) {
+                pTask = steal_task(0, mWorkers.size(), node.workerBegin + node.workerCount, priority);
+            }
+        } else {
+            pTask = steal_task(0, mWorkers.size(), mPushWorkerIndex.load(std::memory_order_relaxed), priority);
+        }
+        return pTask;
+    }
+
+    Task* steal_task(size_t workerBegin, size_t workerCount, size_t workerIndex, size_t priority)
+    {
+        Task* pTask = nullptr;
+        for (size_t i = 0; i < workerCount && !pTask; ++i) {
+            auto& victim = *mWorkers[workerBegin + (workerIndex + i) % workerCount];
+            auto& queue = victim.queues[priority];
+            if (queue.taskCount.load(std::memory_order_relaxed)) {
+                std::lock_guard<std::mutex> lock(victim.mutex);
+                if (!queue.tasks.empty()) {
+                    pTask = queue.tasks.front();
+                    queue.tasks.pop_front();
+                    queue.taskCount = queue.tasks.size();
+                }
+            }
+        }
+        return pTask;
+    }
+
+    void start_worker(Worker& worker)
+    {
+        // NOTE : mResizeMutex must be locked.  A thread that was asked to stop but
+        //  hasn't exited yet keeps running, otherwise its slot gets a new thread.
+        worker.stopRequested = false;
+        if (worker.thread.joinable()) {
+            if (!worker.exited) {
+                return;
+            }
+            worker.thread.join();
+        }
+        worker.exited = false;
+        worker.thread = std::thread([this, &worker]() { process_tasks(worker); });
+    }
+
+    bool stop_worker(Worker& worker)
+    {
+        std::lock_guard<std::mutex> lock(mResizeMutex);
+        if (worker.stopRequested) {
+            worker.exited = true;
+            if (mTaskCount) {
+                mMutex.lock();
+                mMutex.unlock();
+                mTaskReceived.notify_one();
+            }
+        }
+        return worker.exited;
+    }
+
+    void grow()
+    {
+        std::unique_lock<std::mutex> lock(mResizeMutex, std::try_to_lock);
+        auto threadCount = mThreadCount.load();
+        if (lock.owns_lock() && mActive && mExecution == Execution::Threaded && threadCount < mWorkers.size()) {
+            start_worker(*mWorkers[threadCount]);
+            mThreadCount = threadCount + 1;
+        }
+    }
+
+    void retire(Worker& worker)
+    {
+        // NOTE : Only the highest running slot retires so running threads always
+        //  occupy slots [0, mThreadCount).
+        std::lock_guard<std::mutex> lock(mResizeMutex);
+        auto threadCount = mThreadCount.load();
+        if (worker.index + 1 == threadCount && threadCount > mMinThreadCount && !worker.stopRequested) {
+            worker.stopRequested = true;
+            mThreadCount = threadCount - 1;
+        }
+    }
+
+    void process_tasks(Worker& worker)
+    {
+        get_current_worker() = &worker;
+        set_affinity(worker);
+        while (true) {
+            auto pTask = get_task(&worker);
+            if (pTask) {
+                execute_task(pTask, worker.counters);
+            } else if (worker.stopRequested && stop_worker(worker)) {
+                break;
+            } else {
+                auto idleBegin = mTimingStatisticsEnabled ? SteadyClock::now() : SteadyClock::time_point { };
+                auto idled = idle([&]() { return !mActive; });
+                if (mTimingStatisticsEnabled) {
+                    auto now = SteadyClock::now();
+                    worker.counters.add(worker.counters.spinNanoseconds, now - idleBegin);
+                    idleBegin = now;
+                }
+                if (!idled) {
+                    auto wake = [&]() { return mTaskCount || !mActive || worker.stopRequested; };
+                    std::unique_lock<std::mutex> lock(mMutex);
+                    ++mSleepingThreadCount;
+                    auto woken = true;
+                    if (mRetireTimeout.count()) {
+                        woken = mTaskReceived.wait_for(lock, mRetireTimeout, wake);
+                    } else {
+                        mTaskReceived.wait(lock, wake);
+                    }
+                    --mSleepingThreadCount;
+                    lock.unlock();
+                    if (mTimingStatisticsEnabled) {
+                        worker.counters.add(worker.counters.idleNanoseconds, SteadyClock::now() - idleBegin);
+                    }
+                    if (!woken) {
+                        retire(worker);
+                    }
+                }
+                if (!mActive && !mTaskCount) {
+                    break;
+                }
+            }
+        }
+        get_current_worker() = nullptr;
+    }
+
+    static void pause()
+    {
+        #if defined(DYNAMIC_STATIC_COMPILER_MSVC) && (defined(_M_X64) || defined(_M_IX86))
+        _mm_pause();
+        #elif defined(__x86_64__) || defined(__i386__)
+        __builtin_ia32_pause();
+        #elif defined(__aarch64__) || defined(__arm__)
+        asm volatile("yield");
+        #endif
+    }
+
+    template <typename PredicateType>
+    bool idle(PredicateType&& predicate)
+    {
+        // NOTE : Spinning and yielding threads aren't counted in mSleepingThreadCount
+        //  so pushing tasks doesn't pay to notify them, they see mTaskCount change.
+        if (mSpinDuration.count() || mYieldDuration.count()) {
+            auto start = SteadyClock::now();
+            auto spinEnd = start + mSpinDuration;
+            auto yieldEnd = spinEnd + mYieldDuration;
+            for (auto now = start; now < yieldEnd; now = SteadyClock::now()) {
+                if (mTaskCount.load(std::memory_order_relaxed) || predicate()) {
+                    return true;
+                }
+                if (now < spinEnd) {
+                    pause();
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        }
+        return false;
+    }
+
+    void execute_task(Task* pTask, Counters& counters) noexcept
+    {
+        // NOTE : noexcept so that exceptions thrown by detached tasks call
+        //  std::terminate() on every path that executes tasks, including Deferred
+        //  and Immediate execution and threads waiting in
+        //  process_pending_tasks_until(), rather than unwinding into the caller and
+        //  leaving this ThreadPool object's counters and the Task unreleased.
+        --mTaskCount;
+        if (pTask->cancellationToken.is_cancelled()) {
+            free_task(pTask);
+            counters.add(counters.cancelledTaskCount, 1);
+            complete_tasks(1);
+            return;
+        }
+        ++mActiveThreadCount;
+        auto& pCancellationToken = get_current_task_cancellation_token();
+        auto pPreviousCancellationToken = pCancellationToken;
+        pCancellationToken = &pTask->cancellationToken;
+        if (mTimingStatisticsEnabled || mGrowLatency.count()) {
+            auto begin = SteadyClock::now();
+            auto latency = begin - pTask->enqueueTime;
+            if (mGrowLatency.count() && mGrowLatency < latency) {
+                grow();
+            }
+            if (mTimingStatisticsEnabled) {
+                counters.add_latency(latency);
+            }
+            pTask->function();
+            if (mTimingStatisticsEnabled) {
+                counters.add(counters.busyNanoseconds, SteadyClock::now() - begin);
+            }
+        } else {
+            pTask->function();
+        }
+        pCancellationToken = pPreviousCancellationToken;
+        free_task(pTask);
+        --mActiveThreadCount;
+        counters.add(counters.executedTaskCount, 1);
+        complete_tasks(1);
+    }
+
+    void complete_tasks(size_t count)
+    {
+        if (mIncompleteTaskCount.fetch_sub(count) == count) {
+            mMutex.lock();
+            mMutex.unlock();
+            mTasksComplete.notify_all();
+            if (mExecution == Execution::Deferred) {
+                notify_waiters();
+            }
+        }
+    }
+
+    std::atomic_bool mActive { true };
+    SteadyClock::duration mSpinDuration { };
+    SteadyClock::duration mYieldDuration { };
+    SteadyClock::duration mGrowLatency { };
+    SteadyClock::duration mRetireTimeout { };
+    bool mTimingStatisticsEnabled { false };
+    Execution mExecution { Execution::Threaded };
+    std::vector<std::unique_ptr<Worker>> mWorkers;
+    std::atomic_size_t mThreadCount { 0 };
+    size_t mMinThreadCount { 0 };
+    std::mutex mResizeMutex;
+    std::vector<Node> mNodes;
+    std::atomic_size_t mPushWorkerIndex { 0 };
+    std::atomic_size_t mActiveThreadCount { 0 };
+    std::atomic_size_t mSleepingThreadCount { 0 };
+    std::atomic_size_t mWaitingThreadCount { 0 };
+    std::atomic_size_t mTaskCount { 0 };
+    std::atomic_size_t mTaskCounts[PriorityCount] { };
+    std::atomic_size_t mIncompleteTaskCount { 0 };
+    Counters mOtherThreadCounters { true };
+    std::mutex mMutex;
+    std::condition_variable mTaskReceived;
+    std::condition_variable mTasksComplete;
+    std::mutex mFreeTaskMutex;
+    Task* mpFreeTasks { nullptr };
+    std::vector<std::unique_ptr<Task[]>> mTaskBlocks;
+    mutable std::mutex mTimerMutex;
+    std::condition_variable mTimerCondition;
+    std::thread mTimerThread;
+    bool mTimersActive { true };
+    SteadyClock::time_point mTimerEpoch { SteadyClock::now() };
+    uint64_t mTimerWakeTick { TimerWheel<Timer>::InvalidTick };
+    TimerWheel<Timer> mTimerWheel;
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool(ThreadPool&&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+    ThreadPool& operator=(ThreadPool&&) = delete;
+};
+
+template <typename T>
+inline void Future<T>::wait() const
+{
+    assert(valid());
+    if (!mspState->is_ready()) {
+        auto pState = mspState.get();
+        mpThreadPool->process_pending_tasks_until([pState]() { return pState->is_ready(); });
+    }
+}
 
 } // namespace dst
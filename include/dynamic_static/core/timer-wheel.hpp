@@ -0,0 +1,384 @@
+/*
+==========================================
+  Copyright (c) 2020 Dynamic_Static
+    Patrick Purcell
+      Licensed under the MIT license
+    http://opensource.org/licenses/MIT
+==========================================
+*/
+
+#pragma once
+
+#include "dynamic_static/core/defines.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace dst {
+
+/**
+Hierarchical timing wheel that stores values until a specified tick
+@param <T> The type of value stored in this TimerWheel<>
+    @note Inserting, erasing, and rescheduling entries is O(1), each entry is moved between levels at most LevelCount times before it expires
+    @note Ticks are unitless, callers choose the duration of a tick and advance this TimerWheel<> as time passes
+    @note Entries whose tick is beyond the range of the highest level are kept in an overflow list and reinserted each time the highest level wraps
+    @note T must be default constructible, erased entries are assigned a default constructed T so their resources are released
+*/
+template <typename T>
+class TimerWheel final
+{
+public:
+    /**
+    Identifies an entry in a TimerWheel<>
+    */
+    using Id = uint64_t;
+
+    /**
+    The Id that doesn't identify any entry
+    */
+    static constexpr Id InvalidId { 0 };
+
+    /**
+    The tick returned by get_next_tick() when this TimerWheel<> is empty
+    */
+    static constexpr uint64_t InvalidTick { std::numeric_limits<uint64_t>::max() };
+
+    /**
+    The number of bits of a tick resolved by each level
+    */
+    static constexpr uint64_t SlotBits { 6 };
+
+    /**
+    The number of slots in each level
+    */
+    static constexpr uint64_t SlotCount { (uint64_t)1 << SlotBits };
+
+    /**
+    The number of levels
+    */
+    static constexpr uint64_t LevelCount { 4 };
+
+    /**
+    Constructs an instance of TimerWheel<>
+    @param [in] tick (optional = 0) This TimerWheel<> object's initial tick
+    */
+    inline explicit TimerWheel(uint64_t tick = 0)
+        : mTick { tick }
+    {
+        for (auto& level : mLevels) {
+            level.slots.fill(Invalid);
+        }
+    }
+
+    /**
+    Gets the next tick this TimerWheel<> will process
+    @return The next tick this TimerWheel<> will process
+    */
+    inline uint64_t get_tick() const
+    {
+        return mTick;
+    }
+
+    /**
+    Gets this TimerWheel<> object's number of entries
+    @return This TimerWheel<> object's number of entries
+        @note Expired entries that haven't been erased or rescheduled are counted
+    */
+    inline size_t size() const
+    {
+        return mEntries.size() - mFreeEntries.size();
+    }
+
+    /**
+    Gets a value indicating whether or not this TimerWheel<> has no entries
+    @return Whether or not this TimerWheel<> has no entries
+    */
+    inline bool empty() const
+    {
+        return !size();
+    }
+
+    /**
+    Adds an entry to this TimerWheel<>
+    @param [in] tick The tick the entry expires at, ticks before get_tick() expire on the next call to advance()
+    @param [in] value The value to store
+    @return The Id of the added entry
+    */
+    inline Id insert(uint64_t tick, T value)
+    {
+        uint32_t index = 0;
+        if (!mFreeEntries.empty()) {
+            index = mFreeEntries.back();
+            mFreeEntries.pop_back();
+            mEntries[index].value = std::move(value);
+        } else {
+            index = (uint32_t)mEntries.size();
+            mEntries.push_back({ });
+            mEntries.back().value = std::move(value);
+        }
+        auto& entry = mEntries[index];
+        ++entry.generation;
+        entry.used = true;
+        link(index, tick);
+        return make_id(index, entry.generation);
+    }
+
+    /**
+    Gets the value of a specified entry
+    @param [in] id The Id of the entry to get the value of
+    @return A pointer to the entry's value, or nullptr if the Id doesn't identify an entry
+    */
+    inline T* get(Id id)
+    {
+        auto index = get_index(id);
+        return index != Invalid ? &mEntries[index].value : nullptr;
+    }
+
+    /**
+    Gets the tick of a specified entry
+    @param [in] id The Id of the entry to get the tick of
+    @return The entry's tick, or InvalidTick if the Id doesn't identify an entry
+    */
+    inline uint64_t get_tick(Id id) const
+    {
+        auto index = get_index(id);
+        return index != Invalid ? mEntries[index].tick : InvalidTick;
+    }
+
+    /**
+    Moves a specified entry to a specified tick
+    @param [in] id The Id of the entry to move
+    @param [in] tick The tick the entry expires at, ticks before get_tick() expire on the next call to advance()
+    @return Whether or not the entry was moved
+        @note Expired entries can be rescheduled, the entry keeps its Id
+    */
+    inline bool reschedule(Id id, uint64_t tick)
+    {
+        auto index = get_index(id);
+        if (index != Invalid) {
+            unlink(index);
+            link(index, tick);
+        }
+        return index != Invalid;
+    }
+
+    /**
+    Removes a specified entry
+    @param [in] id The Id of the entry to remove
+    @return Whether or not the entry was removed
+    */
+    inline bool erase(Id id)
+    {
+        auto index = get_index(id);
+        if (index != Invalid) {
+            unlink(index);
+            auto& entry = mEntries[index];
+            entry.value = T { };
+            entry.used = false;
+            mFreeEntries.push_back(index);
+        }
+        return index != Invalid;
+    }
+
+    /**
+    Gets the earliest tick at which advance() has work to do
+    @return The earliest tick at which advance() has work to do, or InvalidTick if there are no pending entries
+        @note The returned tick is the tick of the earliest entry or the tick at which entries are moved to a lower level, whichever is earlier
+    */
+    inline uint64_t get_next_tick() const
+    {
+        // NOTE : Slots before the current slot of each level are always empty, so
+        //  the first occupied slot at or after the current slot is the earliest.
+        auto nextTick = InvalidTick;
+        for (uint64_t level = 0; level < LevelCount; ++level) {
+            auto shift = level * SlotBits;
+            auto slot = (mTick >> shift) & (SlotCount - 1);
+            auto occupancy = mLevels[level].occupancy & (~(uint64_t)0 << slot);
+            if (occupancy) {
+                auto occupiedSlot = (uint64_t)count_trailing_zeros(occupancy);
+                auto blockBegin = mTick >> (shift + SlotBits) << (shift + SlotBits);
+                auto tick = blockBegin + (occupiedSlot << shift);
+                nextTick = std::min(nextTick, tick);
+            }
+        }
+        if (mOverflow != Invalid) {
+            auto shift = LevelCount * SlotBits;
+            auto mask = ((uint64_t)1 << shift) - 1;
+            nextTick = std::min(nextTick, (mTick + mask) & ~mask);
+        }
+        return nextTick;
+    }
+
+    /**
+    Processes all ticks up to and including a specified tick
+    @param [in] tick The last tick to process
+    @param [out] expiredIds A std::vector<> to append the Ids of expired entries to
+        @note Expired entries stay in this TimerWheel<> until they're erased or rescheduled
+        @note Ticks with no work are skipped so advancing over idle ticks is cheap
+    */
+    inline void advance(uint64_t tick, std::vector<Id>& expiredIds)
+    {
+        while (mTick <= tick) {
+            auto nextTick = get_next_tick();
+            if (tick < nextTick) {
+                mTick = tick + 1;
+                break;
+            }
+            mTick = nextTick;
+            process_tick(expiredIds);
+            ++mTick;
+        }
+    }
+
+private:
+    static constexpr uint32_t Invalid { std::numeric_limits<uint32_t>::max() };
+    static constexpr uint32_t Expired { Invalid - 1 };
+    static constexpr uint32_t Overflow { Invalid - 2 };
+
+    struct Entry final
+    {
+        T value { };
+        uint64_t tick { 0 };
+        uint32_t slot { Invalid };
+        uint32_t previous { Invalid };
+        uint32_t next { Invalid };
+        uint32_t generation { 0 };
+        bool used { false };
+    };
+
+    struct Level final
+    {
+        uint64_t occupancy { 0 };
+        std::array<uint32_t, SlotCount> slots { };
+    };
+
+    static Id make_id(uint32_t index, uint32_t generation)
+    {
+        return ((Id)generation << 32) | ((Id)index + 1);
+    }
+
+    uint32_t get_index(Id id) const
+    {
+        auto index = (uint32_t)(id & 0xFFFFFFFF) - 1;
+        auto generation = (uint32_t)(id >> 32);
+        auto valid = id != InvalidId && index < mEntries.size() && mEntries[index].used && mEntries[index].generation == generation;
+        return valid ? index : Invalid;
+    }
+
+    static int count_trailing_zeros(uint64_t value)
+    {
+        int count = 0;
+        while (!(value & 1)) {
+            value >>= 1;
+            ++count;
+        }
+        return count;
+    }
+
+    uint32_t& get_list(uint32_t slot)
+    {
+        return slot == Overflow ? mOverflow : mLevels[slot / SlotCount].slots[slot % SlotCount];
+    }
+
+    void link(uint32_t index, uint64_t tick)
+    {
+        // NOTE : An entry goes in the lowest level whose slot covers every tick from
+        //  mTick to the entry's tick, ie. the entry's tick and mTick agree on every
+        //  bit above that level.  Higher level slots are moved down when mTick
+        //  reaches the beginning of the slot.
+        auto& entry = mEntries[index];
+        entry.tick = tick;
+        tick = std::max(tick, mTick);
+        entry.slot = Overflow;
+        for (uint64_t level = 0; level < LevelCount; ++level) {
+            auto shift = (level + 1) * SlotBits;
+            if ((tick >> shift) == (mTick >> shift)) {
+                auto slot = (tick >> (level * SlotBits)) & (SlotCount - 1);
+                entry.slot = (uint32_t)(level * SlotCount + slot);
+                mLevels[level].occupancy |= (uint64_t)1 << slot;
+                break;
+            }
+        }
+        auto& head = get_list(entry.slot);
+        entry.previous = Invalid;
+        entry.next = head;
+        if (head != Invalid) {
+            mEntries[head].previous = index;
+        }
+        head = index;
+    }
+
+    void unlink(uint32_t index)
+    {
+        auto& entry = mEntries[index];
+        if (entry.slot != Expired) {
+            auto& head = get_list(entry.slot);
+            if (entry.previous != Invalid) {
+                mEntries[entry.previous].next = entry.next;
+            } else {
+                head = entry.next;
+            }
+            if (entry.next != Invalid) {
+                mEntries[entry.next].previous = entry.previous;
+            }
+            if (head == Invalid && entry.slot != Overflow) {
+                mLevels[entry.slot / SlotCount].occupancy &= ~((uint64_t)1 << (entry.slot % SlotCount));
+            }
+            entry.slot = Expired;
+        }
+    }
+
+    uint32_t take_list(uint32_t slot)
+    {
+        auto& head = get_list(slot);
+        auto index = head;
+        head = Invalid;
+        if (slot != Overflow) {
+            mLevels[slot / SlotCount].occupancy &= ~((uint64_t)1 << (slot % SlotCount));
+        }
+        return index;
+    }
+
+    void process_tick(std::vector<Id>& expiredIds)
+    {
+        // NOTE : Higher levels are moved down first so entries that land in a lower
+        //  level's current slot are handled in the same tick.
+        if (!(mTick & ((((uint64_t)1) << (LevelCount * SlotBits)) - 1))) {
+            relink(take_list(Overflow));
+        }
+        for (auto level = LevelCount - 1; level; --level) {
+            auto shift = level * SlotBits;
+            if (!(mTick & ((((uint64_t)1) << shift) - 1))) {
+                relink(take_list((uint32_t)(level * SlotCount + ((mTick >> shift) & (SlotCount - 1)))));
+            }
+        }
+        for (auto index = take_list((uint32_t)(mTick & (SlotCount - 1))); index != Invalid;) {
+            auto& entry = mEntries[index];
+            auto next = entry.next;
+            entry.slot = Expired;
+            expiredIds.push_back(make_id(index, entry.generation));
+            index = next;
+        }
+    }
+
+    void relink(uint32_t index)
+    {
+        while (index != Invalid) {
+            auto next = mEntries[index].next;
+            link(index, mEntries[index].tick);
+            index = next;
+        }
+    }
+
+    uint64_t mTick { 0 };
+    std::array<Level, LevelCount> mLevels { };
+    uint32_t mOverflow { Invalid };
+    std::vector<Entry> mEntries;
+    std::vector<uint32_t> mFreeEntries;
+};
+
+} // namespace dst
@@ -0,0 +1,41 @@
+/*
+==========================================
+  Copyright (c) 2020 Dynamic_Static
+    Patrick Purcell
+      Licensed under the MIT license
+    http://opensource.org/licenses/MIT
+==========================================
+*/
+
+#include "dynamic_static/core/cancellation-token.hpp"
+
+#include "catch2/catch.hpp"
+
+namespace dst {
+namespace tests {
+
+/**
+Validates that CancellationToken objects observe their CancellationSource
+*/
+TEST_CASE("CancellationSource::cancel()", "[CancellationToken]")
+{
+    CancellationToken defaultToken;
+    CHECK_FALSE(defaultToken.can_be_cancelled());
+    CHECK_FALSE(defaultToken.is_cancelled());
+    CancellationSource cancellationSource;
+    auto token = cancellationSource.get_token();
+    auto tokenCopy = token;
+    CHECK(token.can_be_cancelled());
+    CHECK_FALSE(token.is_cancelled());
+    CHECK_FALSE(cancellationSource.is_cancelled());
+    auto cancellationSourceCopy = cancellationSource;
+    cancellationSourceCopy.cancel();
+    CHECK(cancellationSource.is_cancelled());
+    CHECK(token.is_cancelled());
+    CHECK(tokenCopy.is_cancelled());
+    CHECK(cancellationSource.get_token().is_cancelled());
+    CHECK_FALSE(CancellationSource().get_token().is_cancelled());
+}
+
+} // namespace tests
+} // namespace dst
@@ -0,0 +1,160 @@
+/*
+==========================================
+  Copyright (c) 2020 Dynamic_Static
+    Patrick Purcell
+      Licensed under the MIT license
+    http://opensource.org/licenses/MIT
+==========================================
+*/
+
+#include "dynamic_static/core/concurrent-delegate.hpp"
+
+#include "catch2/catch.hpp"
+
+#include <atomic>
+#include <future>
+#include <thread>
+#include <vector>
+
+namespace dst {
+namespace tests {
+
+/**
+Validates that ConcurrentDelegate<>::subscribe() adds subscribers that are called in the order they were subscribed in
+*/
+TEST_CASE("ConcurrentDelegate<>::subscribe()", "[ConcurrentDelegate<>]")
+{
+    std::vector<int> values;
+    ConcurrentDelegate<int> delegate;
+    CHECK(delegate.subscribe(nullptr) == ConcurrentDelegate<int>::InvalidSubscriptionId);
+    auto id0 = delegate.subscribe([&](int value) { values.push_back(value); });
+    auto id1 = delegate.subscribe([&](int value) { values.push_back(value * 10); });
+    CHECK(id0 != ConcurrentDelegate<int>::InvalidSubscriptionId);
+    CHECK(id1 != id0);
+    CHECK(delegate.get_subscriber_count() == 2);
+    delegate(2);
+    CHECK(values == std::vector<int> { 2, 20 });
+}
+
+/**
+Validates that ConcurrentDelegate<>::unsubscribe() removes subscribers
+*/
+TEST_CASE("ConcurrentDelegate<>::unsubscribe()", "[ConcurrentDelegate<>]")
+{
+    int count = 0;
+    ConcurrentDelegate<> delegate;
+    auto id0 = delegate.subscribe([&]() { count += 1; });
+    auto id1 = delegate.subscribe([&]() { count += 10; });
+    CHECK(delegate.unsubscribe(id0));
+    CHECK(!delegate.unsubscribe(id0));
+    delegate();
+    CHECK(count == 10);
+    delegate.clear();
+    CHECK(delegate.get_subscriber_count() == 0);
+    CHECK(!delegate.unsubscribe(id1));
+    delegate();
+    CHECK(count == 10);
+}
+
+/**
+Validates that ConcurrentDelegate<> subscribers can subscribe to and unsubscribe from the ConcurrentDelegate<> that's calling them
+*/
+TEST_CASE("ConcurrentDelegate<>::operator() (reentrant)", "[ConcurrentDelegate<>]")
+{
+    int count = 0;
+    ConcurrentDelegate<> delegate;
+    ConcurrentDelegate<>::SubscriptionId id = ConcurrentDelegate<>::InvalidSubscriptionId;
+    id = delegate.subscribe(
+        [&]()
+        {
+            ++count;
+            delegate.unsubscribe(id);
+            delegate.subscribe([&]() { count += 10; });
+        }
+    );
+    delegate();
+    CHECK(count == 1);
+    delegate();
+    CHECK(count == 11);
+    CHECK(delegate.get_subscriber_count() == 1);
+}
+
+/**
+Validates that a ConcurrentDelegate<> subscriber can subscribe while another thread's subscribe() is waiting for the subscriber's call to finish
+*/
+TEST_CASE("ConcurrentDelegate<>::operator() (reentrant, concurrent)", "[ConcurrentDelegate<>]")
+{
+    std::atomic_int count { 0 };
+    std::promise<void> dispatching;
+    ConcurrentDelegate<> delegate;
+    auto id = delegate.subscribe(
+        [&]()
+        {
+            dispatching.set_value();
+            // NOTE : The other thread's subscriber is visible once the other thread
+            //  has replaced the subscriber list, it then waits for this call to
+            //  finish before returning from subscribe().
+            while (delegate.get_subscriber_count() < 2) {
+                std::this_thread::yield();
+            }
+            delegate.subscribe([&]() { count += 10; });
+        }
+    );
+    std::thread thread(
+        [&]()
+        {
+            dispatching.get_future().wait();
+            delegate.subscribe([&]() { ++count; });
+        }
+    );
+    delegate();
+    thread.join();
+    CHECK(delegate.unsubscribe(id));
+    delegate();
+    CHECK(count == 11);
+    CHECK(delegate.get_subscriber_count() == 2);
+}
+
+/**
+Validates that ConcurrentDelegate<> can be called while subscribers are added and removed on other threads
+*/
+TEST_CASE("ConcurrentDelegate<>::operator() (concurrent)", "[ConcurrentDelegate<>]")
+{
+    static constexpr int CallerCount { 3 };
+    static constexpr int SubscriptionCount { 256 };
+    ConcurrentDelegate<int> delegate;
+    std::atomic_bool running { true };
+    std::atomic_int calledAfterUnsubscribe { 0 };
+    std::vector<std::thread> callers;
+    for (int i = 0; i < CallerCount; ++i) {
+        callers.emplace_back(
+            [&]()
+            {
+                while (running) {
+                    delegate(1);
+                }
+            }
+        );
+    }
+    for (int i = 0; i < SubscriptionCount; ++i) {
+        auto spUnsubscribed = std::make_shared<std::atomic_bool>(false);
+        auto id = delegate.subscribe(
+            [&, spUnsubscribed](int)
+            {
+                calledAfterUnsubscribe += spUnsubscribed->load() ? 1 : 0;
+            }
+        );
+        std::this_thread::yield();
+        CHECK(delegate.unsubscribe(id));
+        spUnsubscribed->store(true);
+    }
+    running = false;
+    for (auto& caller : callers) {
+        caller.join();
+    }
+    CHECK(calledAfterUnsubscribe == 0);
+    CHECK(delegate.get_subscriber_count() == 0);
+}
+
+} // namespace tests
+} // namespace dst
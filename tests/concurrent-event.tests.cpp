@@ -0,0 +1,59 @@
+/*
+==========================================
+  Copyright (c) 2020 Dynamic_Static
+    Patrick Purcell
+      Licensed under the MIT license
+    http://opensource.org/licenses/MIT
+==========================================
+*/
+
+#include "dynamic_static/core/concurrent-event.hpp"
+
+#include "catch2/catch.hpp"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace dst {
+namespace tests {
+
+class ConcurrentPublisher final
+{
+public:
+    void publish(int value)
+    {
+        on_publish(value);
+    }
+
+    ConcurrentEvent<ConcurrentPublisher, int> on_publish;
+};
+
+/**
+Validates that ConcurrentEvent<> calls subscribers added and removed on multiple threads
+*/
+TEST_CASE("ConcurrentEvent<>", "[ConcurrentEvent<>]")
+{
+    static constexpr int ThreadCount { 4 };
+    ConcurrentPublisher publisher;
+    std::atomic_int sum { 0 };
+    std::vector<ConcurrentEvent<ConcurrentPublisher, int>::SubscriptionId> ids(ThreadCount);
+    std::vector<std::thread> threads;
+    for (int i = 0; i < ThreadCount; ++i) {
+        threads.emplace_back([&, i]() { ids[i] = publisher.on_publish.subscribe([&](int value) { sum += value; }); });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    CHECK(publisher.on_publish.get_subscriber_count() == ThreadCount);
+    publisher.publish(2);
+    CHECK(sum == 2 * ThreadCount);
+    for (auto id : ids) {
+        CHECK(publisher.on_publish.unsubscribe(id));
+    }
+    publisher.publish(2);
+    CHECK(sum == 2 * ThreadCount);
+}
+
+} // namespace tests
+} // namespace dst
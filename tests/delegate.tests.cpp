@@ -9,10 +9,14 @@
 */
 
 #include "dynamic_static/core/delegate.hpp"
+#include "dynamic_static/core/delegate-parallel.hpp"
 #include "dynamic_static/core/random.hpp"
 
 #include "catch2/catch.hpp"
 
+#include <atomic>
+#include <memory>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -38,6 +42,62 @@ TEST_CASE("Delegate<>::operator=()", "[Delegate<>]")
     CHECK(i == 0);
 }
 
+/**
+Validates that move only Action<> objects and Action<> objects that fill Delegate<>::Capacity can be assigned to Delegate<>
+*/
+TEST_CASE("Delegate<>::operator=() (inline storage)", "[Delegate<>]")
+{
+    int i = 0;
+    auto upValue = std::make_unique<int>(2);
+    Delegate<int&> delegate = [upValue = std::move(upValue)](int& value) { value += *upValue; };
+    delegate(i);
+    CHECK(i == 2);
+    struct { char bytes[Delegate<int&>::Capacity - sizeof(int*)]; int* pValue; } largeCapture { { }, &i };
+    delegate = [largeCapture](int& value) { value += *largeCapture.pValue; };
+    delegate(i);
+    CHECK(i == 4);
+    delegate = Action<int&>([](int& value) { ++value; });
+    delegate(i);
+    CHECK(i == 5);
+    delegate = Action<int&>();
+    delegate(i);
+    CHECK(i == 5);
+}
+
+/**
+Validates that Delegate<>::bind() calls a member function on a bound object
+*/
+TEST_CASE("Delegate<>::bind()", "[Delegate<>]")
+{
+    struct Counter final
+    {
+        void add(int value)
+        {
+            count += value;
+        }
+
+        int get(int& value) const
+        {
+            value = count;
+            return count;
+        }
+
+        int count { 0 };
+    };
+    Counter counter;
+    Delegate<int> addDelegate;
+    addDelegate.bind<&Counter::add>(counter);
+    addDelegate(3);
+    addDelegate(4);
+    CHECK(counter.count == 7);
+    int value = 0;
+    const auto& constCounter = counter;
+    Delegate<int&> getDelegate;
+    getDelegate.bind<&Counter::get>(constCounter);
+    getDelegate(value);
+    CHECK(value == 7);
+}
+
 /**
 Validates that Delegate<> objects can be subscribe to and be called via Delegate<>
 */
@@ -106,5 +166,144 @@ TEST_CASE("Delegate<>::~Delegate()", "[Delegate<>]")
     CHECK(actualValue == targetValue);
 }
 
+/**
+Validates that Delegate<>::operator()() handles long subscription chains, subscription cycles, and changes to nested subscriptions
+*/
+TEST_CASE("Delegate<>::operator()() (subscription graph)", "[Delegate<>]")
+{
+    SECTION("Long chain")
+    {
+        int count = 0;
+        std::vector<Delegate<int&>> delegates(100000);
+        for (size_t i = 0; i < delegates.size(); ++i) {
+            delegates[i] = [](int& value) { ++value; };
+            if (i) {
+                delegates[i - 1] += delegates[i];
+            }
+        }
+        delegates[0](count);
+        CHECK(count == (int)delegates.size());
+    }
+    SECTION("Cycles and shared subscribers")
+    {
+        std::vector<int> values;
+        std::vector<Delegate<std::vector<int>&>> delegates(3);
+        for (size_t i = 0; i < delegates.size(); ++i) {
+            delegates[i] = [i](std::vector<int>& values) { values.push_back((int)i); };
+        }
+        delegates[0] += delegates[1];
+        delegates[0] += delegates[2];
+        delegates[1] += delegates[2];
+        delegates[2] += delegates[0];
+        delegates[0](values);
+        CHECK(values == std::vector<int> { 0, 1, 2 });
+    }
+    SECTION("Nested changes")
+    {
+        int count = 0;
+        Delegate<int&> delegate;
+        Delegate<int&> subscriber;
+        delegate += subscriber;
+        delegate(count);
+        CHECK(count == 0);
+        {
+            Delegate<int&> nestedSubscriber = [](int& value) { value += 10; };
+            subscriber += nestedSubscriber;
+            delegate(count);
+            CHECK(count == 10);
+            subscriber = [](int& value) { value += 1; };
+            delegate(count);
+            CHECK(count == 21);
+        }
+        delegate(count);
+        CHECK(count == 22);
+    }
+}
+
+/**
+Validates that Delegate<>::subscribe() and Delegate<>::clear() update subscribed Delegate<> objects
+*/
+TEST_CASE("Delegate<>::subscribe()", "[Delegate<>]")
+{
+    int count = 0;
+    Delegate<int&> delegate;
+    std::vector<Delegate<int&>> delegates(TestCount);
+    std::vector<Subscription> subscriptions;
+    for (auto& subscriber : delegates) {
+        subscriber = [](int& value) { ++value; };
+        subscriptions.push_back(delegate.subscribe(subscriber));
+    }
+    delegate(count);
+    CHECK(count == TestCount);
+    subscriptions.resize(TestCount / 2);
+    delegate(count);
+    CHECK(count == TestCount + TestCount / 2);
+    Delegate<int&>::clear(delegates.begin(), delegates.end());
+    delegate(count);
+    CHECK(count == TestCount + TestCount / 2);
+}
+
+/**
+Validates that a Delegate<> can be called from multiple threads at once while unrelated Delegate<> objects change
+*/
+TEST_CASE("Delegate<>::operator()() (concurrent calls)", "[Delegate<>]")
+{
+    std::atomic_int count { 0 };
+    Delegate<std::atomic_int&> delegate;
+    std::vector<Delegate<std::atomic_int&>> delegates(TestCount);
+    for (auto& subscriber : delegates) {
+        subscriber = [](std::atomic_int& value) { ++value; };
+        delegate += subscriber;
+    }
+    std::vector<std::thread> threads(4);
+    for (auto& thread : threads) {
+        thread = std::thread(
+            [&]()
+            {
+                for (int i = 0; i < TestCount; ++i) {
+                    delegate(count);
+                }
+            }
+        );
+    }
+    Delegate<std::atomic_int&> unrelatedDelegate;
+    Delegate<std::atomic_int&> unrelatedSubscriber;
+    for (int i = 0; i < TestCount; ++i) {
+        unrelatedDelegate += unrelatedSubscriber;
+        unrelatedDelegate -= unrelatedSubscriber;
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    CHECK(count == (int)threads.size() * TestCount * TestCount);
+}
+
+/**
+Validates that parallel_invoke() calls all subscribed Delegate<> objects and stays on the calling thread below its serial threshold
+*/
+TEST_CASE("parallel_invoke() (Delegate<>)", "[Delegate<>]")
+{
+    ThreadPool threadPool(4);
+    std::atomic_int sum { 0 };
+    std::atomic_int otherThreadCallCount { 0 };
+    auto callingThreadId = std::this_thread::get_id();
+    Delegate<int> delegate = [&](int value) { sum += value; };
+    std::vector<Delegate<int>> delegates(TestCount * 4);
+    for (auto& subscriber : delegates) {
+        subscriber = [&](int value)
+        {
+            sum += value;
+            otherThreadCallCount += std::this_thread::get_id() != callingThreadId ? 1 : 0;
+        };
+        delegate += subscriber;
+    }
+    parallel_invoke(threadPool, delegate, delegates.size() + 2, 2);
+    CHECK(sum == 2 * ((int)delegates.size() + 1));
+    CHECK(otherThreadCallCount == 0);
+    sum = 0;
+    parallel_invoke(threadPool, delegate, 1, 2);
+    CHECK(sum == 2 * ((int)delegates.size() + 1));
+}
+
 } // namespace tests
 } // namespace dst
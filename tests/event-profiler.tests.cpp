@@ -0,0 +1,166 @@
+
+/*
+==========================================
+  Copyright (c) 2020 Dynamic_Static
+    Patrick Purcell
+      Licensed under the MIT license
+    http://opensource.org/licenses/MIT
+==========================================
+*/
+
+#include "dynamic_static/core/event.hpp"
+#include "dynamic_static/core/event-profiler.hpp"
+
+#include "catch2/catch.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <new>
+#include <sstream>
+#include <string>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+
+namespace dst {
+namespace tests {
+
+class ProfiledPublisher final
+{
+public:
+    void publish(int value)
+    {
+        on_publish(std::move(value));
+    }
+
+    Event<ProfiledPublisher, int> on_publish;
+};
+
+static std::vector<EventProfiler::Entry> find_entries(const std::vector<EventProfiler::Entry>& entries, const void* pAddress)
+{
+    std::vector<EventProfiler::Entry> foundEntries;
+    for (const auto& entry : entries) {
+        if (entry.pAddress == pAddress) {
+            foundEntries.push_back(entry);
+        }
+    }
+    return foundEntries;
+}
+
+/**
+Validates that EventProfiler::record() accumulates calls per id
+*/
+TEST_CASE("EventProfiler::record()", "[EventProfiler]")
+{
+    EventProfiler::reset();
+    int object = 0;
+    auto id = EventProfiler::create_id();
+    auto otherId = EventProfiler::create_id();
+    CHECK(id != otherId);
+    EventProfiler::record(id, &object, "Object", 2, 10);
+    EventProfiler::record(id, &object, "Object", 3, 30);
+    EventProfiler::record(otherId, &object, "Object", 1, 5);
+    auto entries = EventProfiler::get_entries();
+    REQUIRE(entries.size() == 2);
+    CHECK(entries[0].id == id);
+    CHECK(entries[0].pAddress == &object);
+    CHECK(std::string(entries[0].pTypeName) == "Object");
+    CHECK(entries[0].callCount == 2);
+    CHECK(entries[0].subscriberCount == 5);
+    CHECK(entries[0].totalNanoseconds == 40);
+    CHECK(entries[0].maxNanoseconds == 30);
+    CHECK(entries[1].id == otherId);
+    CHECK(entries[1].callCount == 1);
+    EventProfiler::reset();
+    CHECK(EventProfiler::get_entries().empty());
+}
+
+/**
+Validates that EventProfiler::get_entries() returns the Entry objects with the longest total elapsed time, longest first
+*/
+TEST_CASE("EventProfiler::get_entries()", "[EventProfiler]")
+{
+    EventProfiler::reset();
+    int fast = 0;
+    int slow = 0;
+    int slower = 0;
+    EventProfiler::record(EventProfiler::create_id(), &fast, "Fast", 1, 1);
+    EventProfiler::record(EventProfiler::create_id(), &slow, "Slow", 1, 200);
+    EventProfiler::record(EventProfiler::create_id(), &slower, "Slower", 1, 800);
+    auto entries = EventProfiler::get_entries(2);
+    REQUIRE(entries.size() == 2);
+    CHECK(entries[0].pAddress == &slower);
+    CHECK(entries[1].pAddress == &slow);
+    std::stringstream strm;
+    EventProfiler::dump(strm, 1);
+    auto str = strm.str();
+    CHECK(str.find("Slower") != std::string::npos);
+    CHECK(str.find("1 calls") != std::string::npos);
+    CHECK(std::count(str.begin(), str.end(), '\n') == 1);
+    EventProfiler::reset();
+}
+
+/**
+Validates that Delegate<>::operator()() and Event<>::operator()() calls are recorded when DYNAMIC_STATIC_EVENT_PROFILING_ENABLED is defined
+*/
+TEST_CASE("EventProfiler (Delegate<> and Event<>)", "[EventProfiler]")
+{
+    EventProfiler::reset();
+    int total = 0;
+    ProfiledPublisher publisher;
+    std::vector<Delegate<int>> delegates(3);
+    for (auto& delegate : delegates) {
+        delegate = [&](int value) { total += value; };
+        publisher.on_publish += delegate;
+    }
+    publisher.publish(1);
+    publisher.publish(2);
+    delegates[0](4);
+    CHECK(total == 13);
+    auto entries = EventProfiler::get_entries();
+    #ifdef DYNAMIC_STATIC_EVENT_PROFILING_ENABLED
+    REQUIRE(entries.size() == 2);
+    auto eventEntries = find_entries(entries, &publisher.on_publish);
+    REQUIRE(eventEntries.size() == 1);
+    CHECK(eventEntries[0].callCount == 2);
+    CHECK(eventEntries[0].subscriberCount == 6);
+    CHECK(eventEntries[0].maxNanoseconds <= eventEntries[0].totalNanoseconds);
+    CHECK(std::string(eventEntries[0].pTypeName) == typeid(Event<ProfiledPublisher, int>).name());
+    auto delegateEntries = find_entries(entries, &delegates[0]);
+    REQUIRE(delegateEntries.size() == 1);
+    CHECK(delegateEntries[0].callCount == 1);
+    CHECK(delegateEntries[0].subscriberCount == 1);
+    #else
+    CHECK(entries.empty());
+    #endif
+    EventProfiler::reset();
+}
+
+/**
+Validates that a Delegate<> constructed at the address of a destroyed Delegate<> doesn't share its Entry
+*/
+TEST_CASE("EventProfiler (reused address)", "[EventProfiler]")
+{
+    EventProfiler::reset();
+    alignas(Delegate<int>) uint8_t storage[sizeof(Delegate<int>)];
+    auto pDelegate = new (storage) Delegate<int>([](int) { });
+    (*pDelegate)(0);
+    (*pDelegate)(0);
+    pDelegate->~Delegate<int>();
+    pDelegate = new (storage) Delegate<int>([](int) { });
+    (*pDelegate)(0);
+    auto entries = find_entries(EventProfiler::get_entries(), pDelegate);
+    pDelegate->~Delegate<int>();
+    #ifdef DYNAMIC_STATIC_EVENT_PROFILING_ENABLED
+    REQUIRE(entries.size() == 2);
+    CHECK(entries[0].id != entries[1].id);
+    CHECK(entries[0].callCount + entries[1].callCount == 3);
+    CHECK(std::min(entries[0].callCount, entries[1].callCount) == 1);
+    #else
+    CHECK(entries.empty());
+    #endif
+    EventProfiler::reset();
+}
+
+} // namespace tests
+} // namespace dst
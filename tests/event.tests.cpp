@@ -8,6 +8,7 @@
 ==========================================
 */
 
+#include "dynamic_static/core/delegate-parallel.hpp"
 #include "dynamic_static/core/event.hpp"
 #include "dynamic_static/core/random.hpp"
 
@@ -29,6 +30,11 @@ public:
         on_publish(str);
     }
 
+    void parallel_publish(ThreadPool& threadPool, const std::string& str)
+    {
+        parallel_invoke(threadPool, on_publish, 2, str);
+    }
+
     Event<Publisher, const std::string&> on_publish;
 };
 
@@ -120,5 +126,27 @@ TEST_CASE("Event<>::operator=(Event<>&&)", "[Event<>]")
     }
 }
 
+/**
+Validates that parallel_invoke() calls subscribed Delegate<> objects via a ThreadPool
+*/
+TEST_CASE("parallel_invoke() (Event<>)", "[Event<>]")
+{
+    ThreadPool threadPool(4);
+    Publisher publisher;
+    std::vector<Listener> listeners(TestCount);
+    for (auto& listener : listeners) {
+        publisher.on_publish += listener.publish_handler;
+    }
+    publisher.parallel_publish(threadPool, "the");
+    publisher.parallel_publish(threadPool, "quick");
+    publisher.parallel_publish(threadPool, "brown");
+    publisher.parallel_publish(threadPool, "fox");
+    for (const auto& listener : listeners) {
+        if (listener.sentence != "the quick brown fox") {
+            FAIL();
+        }
+    }
+}
+
 } // namespace tests
 } // namespace dst
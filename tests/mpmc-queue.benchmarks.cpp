@@ -0,0 +1,157 @@
+/*
+==========================================
+  Copyright (c) 2020 Dynamic_Static
+    Patrick Purcell
+      Licensed under the MIT license
+    http://opensource.org/licenses/MIT
+==========================================
+*/
+
+#include "dynamic_static/core/mpmc-queue.hpp"
+#include "dynamic_static/core/spsc-queue.hpp"
+#include "dynamic_static/core/time.hpp"
+
+#include "catch2/catch.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace dst {
+namespace benchmarks {
+
+static constexpr int ElementCount { 1000000 };
+static constexpr size_t QueueCapacity { 1024 };
+
+/**
+Mutex guarded std::deque<> with the same interface as MpmcQueue<>, used as a baseline
+*/
+template <typename T>
+class LockedQueue final
+{
+public:
+    inline explicit LockedQueue(size_t capacity)
+        : mCapacity { capacity }
+    {
+    }
+
+    inline bool try_push(const T& value)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        if (mQueue.size() < mCapacity) {
+            mQueue.push_back(value);
+            return true;
+        }
+        return false;
+    }
+
+    inline bool try_pop(T& value)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        if (!mQueue.empty()) {
+            value = mQueue.front();
+            mQueue.pop_front();
+            return true;
+        }
+        return false;
+    }
+
+private:
+    size_t mCapacity { 0 };
+    std::deque<T> mQueue;
+    std::mutex mMutex;
+};
+
+/**
+Moves ElementCount elements through a given queue with a specified number of producer and consumer threads
+@param <QueueType> The type of queue to measure
+@param [in] name The name to report
+@param [in] producerCount The number of producer threads
+@param [in] consumerCount The number of consumer threads
+@return The sum of all consumed elements
+*/
+template <typename QueueType>
+static long long measure(const std::string& name, int producerCount, int consumerCount)
+{
+    QueueType queue(QueueCapacity);
+    std::atomic_int consumedCount { 0 };
+    std::atomic<long long> sum { 0 };
+    std::vector<std::thread> threads;
+    Timer timer;
+    for (int producer = 0; producer < producerCount; ++producer) {
+        threads.emplace_back(
+            [&, producer]()
+            {
+                for (int i = producer; i < ElementCount; i += producerCount) {
+                    while (!queue.try_push(i)) {
+                        std::this_thread::yield();
+                    }
+                }
+            }
+        );
+    }
+    for (int consumer = 0; consumer < consumerCount; ++consumer) {
+        threads.emplace_back(
+            [&]()
+            {
+                long long localSum = 0;
+                int value = 0;
+                while (consumedCount.load(std::memory_order_relaxed) < ElementCount) {
+                    if (queue.try_pop(value)) {
+                        localSum += value;
+                        consumedCount.fetch_add(1, std::memory_order_relaxed);
+                    } else {
+                        std::this_thread::yield();
+                    }
+                }
+                sum += localSum;
+            }
+        );
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    auto totalMilliseconds = timer.total<Milliseconds<>>();
+    std::cout << name << " (" << producerCount << "P/" << consumerCount << "C) : " << totalMilliseconds << " ms ("
+        << ElementCount / std::max(totalMilliseconds, 0.001) / 1000.0 << " M elements/s)" << std::endl;
+    return sum;
+}
+
+/**
+Compares MpmcQueue<> throughput with a mutex guarded std::deque<>
+    @note Benchmarks are hidden, run with [benchmark] to include them
+*/
+TEST_CASE("MpmcQueue<> vs std::mutex and std::deque<>", "[.][benchmark][MpmcQueue]")
+{
+    const auto expectedSum = (long long)ElementCount * (ElementCount - 1) / 2;
+    std::vector<int> threadCounts { 1 };
+    if (std::thread::hardware_concurrency() / 2 > 1) {
+        threadCounts.push_back((int)std::thread::hardware_concurrency() / 2);
+    }
+    for (auto producerCount : threadCounts) {
+        for (auto consumerCount : threadCounts) {
+            CHECK(measure<MpmcQueue<int>>("MpmcQueue<>", producerCount, consumerCount) == expectedSum);
+            CHECK(measure<LockedQueue<int>>("std::mutex and std::deque<>", producerCount, consumerCount) == expectedSum);
+        }
+    }
+}
+
+/**
+Compares SpscQueue<> throughput with MpmcQueue<> and a mutex guarded std::deque<> with one producer and one consumer
+    @note Benchmarks are hidden, run with [benchmark] to include them
+*/
+TEST_CASE("SpscQueue<> vs MpmcQueue<> vs std::mutex and std::deque<>", "[.][benchmark][SpscQueue]")
+{
+    const auto expectedSum = (long long)ElementCount * (ElementCount - 1) / 2;
+    CHECK(measure<SpscQueue<int>>("SpscQueue<>", 1, 1) == expectedSum);
+    CHECK(measure<MpmcQueue<int>>("MpmcQueue<>", 1, 1) == expectedSum);
+    CHECK(measure<LockedQueue<int>>("std::mutex and std::deque<>", 1, 1) == expectedSum);
+}
+
+} // namespace benchmarks
+} // namespace dst
@@ -0,0 +1,173 @@
+/*
+==========================================
+  Copyright (c) 2020 Dynamic_Static
+    Patrick Purcell
+      Licensed under the MIT license
+    http://opensource.org/licenses/MIT
+==========================================
+*/
+
+#include "dynamic_static/core/mpmc-queue.hpp"
+
+#include "catch2/catch.hpp"
+
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace dst {
+namespace tests {
+
+static constexpr int TestCount { 4096 };
+
+/**
+Validates that MpmcQueue<> capacity is rounded up to a power of two
+*/
+TEST_CASE("MpmcQueue<>::capacity()", "[MpmcQueue]")
+{
+    CHECK(MpmcQueue<int>(0).capacity() == 2);
+    CHECK(MpmcQueue<int>(2).capacity() == 2);
+    CHECK(MpmcQueue<int>(3).capacity() == 4);
+    CHECK(MpmcQueue<int>(64).capacity() == 64);
+    CHECK(MpmcQueue<int>(65).capacity() == 128);
+}
+
+/**
+Validates that MpmcQueue<> elements are popped in the order they're pushed and that pushing fails when full
+*/
+TEST_CASE("MpmcQueue<>::try_push() and MpmcQueue<>::try_pop()", "[MpmcQueue]")
+{
+    MpmcQueue<int> queue(4);
+    int value = 0;
+    CHECK(queue.empty());
+    CHECK_FALSE(queue.try_pop(value));
+    for (int round = 0; round < 4; ++round) {
+        for (int i = 0; i < 4; ++i) {
+            CHECK(queue.try_push(round * 4 + i));
+        }
+        CHECK(queue.size() == 4);
+        CHECK_FALSE(queue.try_push(-1));
+        for (int i = 0; i < 4; ++i) {
+            CHECK(queue.try_pop(value));
+            CHECK(value == round * 4 + i);
+        }
+        CHECK(queue.empty());
+        CHECK_FALSE(queue.try_pop(value));
+    }
+}
+
+/**
+Validates that MpmcQueue<> supports move only types and destroys remaining elements
+*/
+TEST_CASE("MpmcQueue<> (move only elements)", "[MpmcQueue]")
+{
+    auto spCounter = std::make_shared<int>(0);
+    {
+        MpmcQueue<std::shared_ptr<int>> queue(8);
+        for (int i = 0; i < 8; ++i) {
+            CHECK(queue.try_push(spCounter));
+        }
+        CHECK(spCounter.use_count() == 9);
+        std::shared_ptr<int> spValue;
+        CHECK(queue.try_pop(spValue));
+        spValue.reset();
+        CHECK(spCounter.use_count() == 8);
+    }
+    CHECK(spCounter.use_count() == 1);
+    MpmcQueue<std::unique_ptr<int>> queue(2);
+    auto upValue = std::make_unique<int>(7);
+    CHECK(queue.try_push(std::move(upValue)));
+    CHECK(queue.try_emplace(std::make_unique<int>(8)));
+    upValue = std::make_unique<int>(9);
+    CHECK_FALSE(queue.try_push(std::move(upValue)));
+    REQUIRE(upValue);
+    CHECK(queue.try_pop(upValue));
+    CHECK(*upValue == 7);
+    CHECK(queue.try_pop(upValue));
+    CHECK(*upValue == 8);
+}
+
+/**
+Validates that MpmcQueue<>::try_emplace() leaves the MpmcQueue<> usable when construction throws
+*/
+TEST_CASE("MpmcQueue<>::try_emplace() (exceptions)", "[MpmcQueue]")
+{
+    struct ThrowingValue final
+    {
+        ThrowingValue() = default;
+
+        ThrowingValue(size_t count, char c)
+            : str(count, c)
+        {
+        }
+
+        explicit ThrowingValue(std::nullptr_t)
+        {
+            throw std::runtime_error("ThrowingValue");
+        }
+
+        std::string str;
+    };
+    MpmcQueue<ThrowingValue> queue(2);
+    CHECK_THROWS_AS(queue.try_emplace(nullptr), std::runtime_error);
+    CHECK(queue.empty());
+    CHECK(queue.try_emplace((size_t)3, 'a'));
+    ThrowingValue value;
+    CHECK(queue.try_pop(value));
+    CHECK(value.str == "aaa");
+}
+
+/**
+Validates that MpmcQueue<> delivers every element exactly once with concurrent producers and consumers
+*/
+TEST_CASE("MpmcQueue<> (concurrent producers and consumers)", "[MpmcQueue]")
+{
+    const int ThreadCount = 4;
+    MpmcQueue<int> queue(64);
+    std::vector<std::atomic_int> received(ThreadCount * TestCount);
+    std::atomic_int receivedCount { 0 };
+    std::vector<std::thread> threads;
+    for (int producer = 0; producer < ThreadCount; ++producer) {
+        threads.emplace_back(
+            [&, producer]()
+            {
+                for (int i = 0; i < TestCount; ++i) {
+                    while (!queue.try_push(producer * TestCount + i)) {
+                        std::this_thread::yield();
+                    }
+                }
+            }
+        );
+    }
+    for (int consumer = 0; consumer < ThreadCount; ++consumer) {
+        threads.emplace_back(
+            [&]()
+            {
+                int value = 0;
+                while (receivedCount.load() < ThreadCount * TestCount) {
+                    if (queue.try_pop(value)) {
+                        ++received[value];
+                        ++receivedCount;
+                    } else {
+                        std::this_thread::yield();
+                    }
+                }
+            }
+        );
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    CHECK(queue.empty());
+    int errorCount = 0;
+    for (auto& count : received) {
+        errorCount += count != 1;
+    }
+    CHECK(errorCount == 0);
+}
+
+} // namespace tests
+} // namespace dst
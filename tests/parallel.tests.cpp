@@ -0,0 +1,159 @@
+/*
+==========================================
+  Copyright (c) 2020 Dynamic_Static
+    Patrick Purcell
+      Licensed under the MIT license
+    http://opensource.org/licenses/MIT
+==========================================
+*/
+
+#include "dynamic_static/core/parallel.hpp"
+#include "dynamic_static/core/thread-pool.hpp"
+
+#include "catch2/catch.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace dst {
+namespace tests {
+
+static constexpr int TestCount { 4096 };
+
+/**
+Validates that parallel_for() calls its function once for each index
+*/
+TEST_CASE("parallel_for()", "[parallel_for]")
+{
+    ThreadPool threadPool;
+    std::vector<int> values(TestCount);
+    SECTION("Per index function")
+    {
+        parallel_for(threadPool, 0, TestCount, 0, [&](int i) { values[i] += i; });
+    }
+    SECTION("Per chunk function")
+    {
+        parallel_for(threadPool, 0, TestCount, 7, [&](int begin, int end) { for (int i = begin; i < end; ++i) { values[i] += i; } });
+    }
+    SECTION("Grain size larger than range")
+    {
+        parallel_for(threadPool, 0, TestCount, TestCount * 2, [&](int i) { values[i] += i; });
+    }
+    for (int i = 0; i < TestCount; ++i) {
+        if (values[i] != i) {
+            FAIL();
+        }
+    }
+}
+
+/**
+Validates that parallel_for() can be called from ThreadPool threads
+*/
+TEST_CASE("parallel_for() (nested)", "[parallel_for]")
+{
+    ThreadPool threadPool(2);
+    std::atomic_int count { 0 };
+    parallel_for(threadPool, 0, 64, 1,
+        [&](int)
+        {
+            parallel_for(threadPool, 0, 64, 1, [&](int) { ++count; });
+        }
+    );
+    CHECK(count == 64 * 64);
+}
+
+/**
+Validates that parallel_for() rethrows exceptions after completing its range
+*/
+TEST_CASE("parallel_for() (exceptions)", "[parallel_for]")
+{
+    ThreadPool threadPool;
+    std::atomic_int count { 0 };
+    auto function = [&](int i)
+    {
+        ++count;
+        if (i == TestCount / 2) {
+            throw std::runtime_error("parallel_for()");
+        }
+    };
+    CHECK_THROWS_AS(parallel_for(threadPool, 0, TestCount, 1, function), std::runtime_error);
+    CHECK(count == TestCount);
+}
+
+/**
+Validates that parallel_for() with a grain size of 0 processes each index once in small chunks
+*/
+TEST_CASE("parallel_for() (adaptive)", "[parallel_for]")
+{
+    SECTION("Threaded")
+    {
+        ThreadPool threadPool(4);
+        std::vector<std::atomic_int> counts(TestCount);
+        std::atomic_int maxChunkSize { 0 };
+        parallel_for(threadPool, 0, TestCount, 0,
+            [&](int begin, int end)
+            {
+                auto chunkSize = end - begin;
+                for (auto size = maxChunkSize.load(); size < chunkSize && !maxChunkSize.compare_exchange_weak(size, chunkSize);) { }
+                for (int i = begin; i < end; ++i) {
+                    ++counts[i];
+                    if (i % 64 == 0) {
+                        std::this_thread::yield();
+                    }
+                }
+            }
+        );
+        CHECK(maxChunkSize <= TestCount / (4 + 1));
+        for (int i = 0; i < TestCount; ++i) {
+            if (counts[i] != 1) {
+                FAIL();
+            }
+        }
+    }
+    SECTION("Deferred")
+    {
+        ThreadPool threadPool(0);
+        std::vector<int> begins;
+        parallel_for(threadPool, 0, TestCount, 0, [&](int begin, int) { begins.push_back(begin); });
+        REQUIRE(begins.size() > 1);
+        CHECK(std::is_sorted(begins.begin(), begins.end()));
+    }
+}
+
+/**
+Validates that parallel_for() returns when ThreadPool::clear() drops part of its range
+*/
+TEST_CASE("parallel_for() (ThreadPool::clear())", "[parallel_for]")
+{
+    ThreadPool threadPool(0);
+    std::atomic_int count { 0 };
+    parallel_for(threadPool, 0, 64, 1,
+        [&](int)
+        {
+            ++count;
+            threadPool.clear();
+        }
+    );
+    CHECK(count == 1);
+}
+
+/**
+Validates that parallel_reduce() reduces its range in order
+*/
+TEST_CASE("parallel_reduce()", "[parallel_reduce]")
+{
+    ThreadPool threadPool;
+    auto sum = parallel_reduce(threadPool, 0, TestCount, 0, (long long)0, [](int i) { return (long long)i; }, [](long long lhs, long long rhs) { return lhs + rhs; });
+    CHECK(sum == (long long)TestCount * (TestCount - 1) / 2);
+    auto str = parallel_reduce(threadPool, 0, 26, 1, std::string(), [](int i) { return std::string(1, (char)('a' + i)); }, [](std::string lhs, const std::string& rhs) { return lhs + rhs; });
+    CHECK(str == "abcdefghijklmnopqrstuvwxyz");
+    auto empty = parallel_reduce(threadPool, 0, 0, 0, 7, [](int i) { return i; }, [](int lhs, int rhs) { return lhs + rhs; });
+    CHECK(empty == 7);
+}
+
+} // namespace tests
+} // namespace dst
@@ -0,0 +1,186 @@
+/*
+==========================================
+  Copyright (c) 2020 Dynamic_Static
+    Patrick Purcell
+      Licensed under the MIT license
+    http://opensource.org/licenses/MIT
+==========================================
+*/
+
+#include "dynamic_static/core/signal.hpp"
+
+#include "catch2/catch.hpp"
+
+#include <array>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace dst {
+namespace tests {
+
+static constexpr int TestCount { 16 };
+
+/**
+Validates that Signal<>::invoke() passes returned values to a SumCombiner<>
+*/
+TEST_CASE("Signal<>::invoke() (SumCombiner<>)", "[Signal<>]")
+{
+    Signal<int(int)> signal = [](int value) { return value; };
+    std::vector<Signal<int(int)>> subscribers(TestCount);
+    for (int i = 0; i < TestCount; ++i) {
+        subscribers[i] = [i](int value) { return value * i; };
+        signal += subscribers[i];
+    }
+    CHECK(signal.invoke(SumCombiner<int>(), 2) == 2 + 2 * (TestCount * (TestCount - 1) / 2));
+    signal -= subscribers[TestCount - 1];
+    CHECK(signal.invoke(SumCombiner<int>(), 2) == 2 + 2 * ((TestCount - 1) * (TestCount - 2) / 2));
+}
+
+/**
+Validates that Signal<>::invoke() passes returned values to a MinCombiner<> and MaxCombiner<>
+*/
+TEST_CASE("Signal<>::invoke() (MinCombiner<> and MaxCombiner<>)", "[Signal<>]")
+{
+    Signal<int()> signal;
+    CHECK(!signal.invoke(MinCombiner<int>()));
+    CHECK(!signal.invoke(MaxCombiner<int>()));
+    std::vector<Signal<int()>> subscribers(TestCount);
+    for (int i = 0; i < TestCount; ++i) {
+        subscribers[i] = [i]() { return i % 2 ? i : -i; };
+        signal += subscribers[i];
+    }
+    CHECK(signal.invoke(MinCombiner<int>()) == -(TestCount - 2));
+    CHECK(signal.invoke(MaxCombiner<int>()) == TestCount - 1);
+}
+
+/**
+Validates that Signal<>::invoke() stops calling Action<> objects when a combiner returns false
+*/
+TEST_CASE("Signal<>::invoke() (short circuit)", "[Signal<>]")
+{
+    int callCount = 0;
+    int target = 0;
+    Signal<const int*(int)> signal;
+    std::vector<Signal<const int*(int)>> subscribers(TestCount);
+    for (int i = 0; i < TestCount; ++i) {
+        subscribers[i] = [&, i](int key) { ++callCount; return i == key ? &target : nullptr; };
+        signal += subscribers[i];
+    }
+    CHECK(signal.invoke(FirstNonNullCombiner<const int*>(), 3) == &target);
+    CHECK(callCount == 4);
+    callCount = 0;
+    CHECK(signal.invoke(FirstNonNullCombiner<const int*>(), -1) == nullptr);
+    CHECK(callCount == TestCount);
+
+    Signal<bool(int)> predicate;
+    std::vector<Signal<bool(int)>> predicates(TestCount);
+    for (int i = 0; i < TestCount; ++i) {
+        predicates[i] = [&, i](int value) { ++callCount; return i < value; };
+        predicate += predicates[i];
+    }
+    callCount = 0;
+    CHECK(predicate.invoke(AnyCombiner(), 1));
+    CHECK(callCount == 1);
+    callCount = 0;
+    CHECK(!predicate.invoke(AllCombiner(), 2));
+    CHECK(callCount == 3);
+    CHECK(predicate.invoke(AllCombiner(), (int)TestCount));
+}
+
+/**
+Validates that Signal<>::invoke() writes returned values to caller provided storage with a CollectCombiner<>
+*/
+TEST_CASE("Signal<>::invoke() (CollectCombiner<>)", "[Signal<>]")
+{
+    int callCount = 0;
+    Signal<int()> signal;
+    std::vector<Signal<int()>> subscribers(TestCount);
+    for (int i = 0; i < TestCount; ++i) {
+        subscribers[i] = [&, i]() { ++callCount; return i; };
+        signal += subscribers[i];
+    }
+    std::array<int, TestCount> values { };
+    CHECK(signal.invoke(CollectCombiner<int>(values)) == TestCount);
+    for (int i = 0; i < TestCount; ++i) {
+        CHECK(values[i] == i);
+    }
+    callCount = 0;
+    std::array<int, 4> partialValues { };
+    CHECK(signal.invoke(CollectCombiner<int>(partialValues)) == partialValues.size());
+    CHECK(partialValues == std::array<int, 4> { 0, 1, 2, 3 });
+    CHECK(callCount == (int)partialValues.size());
+    callCount = 0;
+    CHECK(signal.invoke(CollectCombiner<int>(Span<int>(nullptr))) == 0);
+    CHECK(callCount == 0);
+}
+
+/**
+Validates that Signal<>::bind() calls a member function and Signal<>::operator()() discards returned values
+*/
+TEST_CASE("Signal<>::bind()", "[Signal<>]")
+{
+    struct Counter final
+    {
+        int increment(int value)
+        {
+            count += value;
+            return count;
+        }
+
+        int count { 0 };
+    };
+    Counter counter;
+    Signal<int(int)> signal;
+    signal.bind<&Counter::increment>(counter);
+    signal(2);
+    signal(3);
+    CHECK(counter.count == 5);
+    CHECK(signal.invoke(SumCombiner<int>(), 1) == 6);
+    Signal<int(int)> moved = std::move(signal);
+    CHECK(moved.invoke(SumCombiner<int>(), 1) == 7);
+    CHECK(signal.invoke(SumCombiner<int>(), 1) == 0);
+}
+
+/**
+Validates that Signal<> objects are called once per call when subscriptions form a cycle
+*/
+TEST_CASE("Signal<>::operator+=() (cycle)", "[Signal<>]")
+{
+    Signal<int()> signal0 = []() { return 1; };
+    Signal<int()> signal1 = []() { return 2; };
+    Signal<int()> signal2 = []() { return 4; };
+    signal0 += signal1;
+    signal1 += signal2;
+    signal2 += signal0;
+    CHECK(signal0.invoke(SumCombiner<int>()) == 7);
+    {
+        auto subscription = signal0.subscribe(signal2);
+        CHECK(subscription.is_subscribed());
+        CHECK(signal1.invoke(SumCombiner<int>()) == 7);
+    }
+    signal1.clear();
+    CHECK(signal0.invoke(SumCombiner<int>()) == 1);
+}
+
+/**
+Validates that Signal<>::invoke() sees changes to nested subscribers and passes rvalue arguments through
+*/
+TEST_CASE("Signal<>::invoke() (nested changes)", "[Signal<>]")
+{
+    Signal<size_t(std::string&&)> signal = [](std::string&& str) { return str.size(); };
+    Signal<size_t(std::string&&)> subscriber;
+    signal += subscriber;
+    CHECK(signal.invoke(SumCombiner<size_t>(), std::string("four")) == 4);
+    {
+        Signal<size_t(std::string&&)> nestedSubscriber = [](std::string&& str) { return std::move(str).size() * 10; };
+        subscriber += nestedSubscriber;
+        CHECK(signal.invoke(SumCombiner<size_t>(), std::string("four")) == 44);
+        subscriber = [](std::string&& str) { return str.size() * 100; };
+        CHECK(signal.invoke(SumCombiner<size_t>(), std::string("four")) == 444);
+    }
+    CHECK(signal.invoke(SumCombiner<size_t>(), std::string("four")) == 404);
+}
+
+} // namespace tests
+} // namespace dst
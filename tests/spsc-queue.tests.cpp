@@ -0,0 +1,96 @@
+/*
+==========================================
+  Copyright (c) 2020 Dynamic_Static
+    Patrick Purcell
+      Licensed under the MIT license
+    http://opensource.org/licenses/MIT
+==========================================
+*/
+
+#include "dynamic_static/core/spsc-queue.hpp"
+
+#include "catch2/catch.hpp"
+
+#include <memory>
+#include <thread>
+
+namespace dst {
+namespace tests {
+
+static constexpr int TestCount { 65536 };
+
+/**
+Validates that SpscQueue<> elements are popped in the order they're pushed and that pushing fails when full
+*/
+TEST_CASE("SpscQueue<>::try_push() and SpscQueue<>::try_pop()", "[SpscQueue]")
+{
+    SpscQueue<int> queue(3);
+    CHECK(queue.capacity() == 4);
+    int value = 0;
+    CHECK(queue.empty());
+    CHECK_FALSE(queue.try_pop(value));
+    for (int round = 0; round < 4; ++round) {
+        for (int i = 0; i < 4; ++i) {
+            CHECK(queue.try_push(round * 4 + i));
+        }
+        CHECK(queue.size() == 4);
+        CHECK_FALSE(queue.try_push(-1));
+        for (int i = 0; i < 4; ++i) {
+            CHECK(queue.try_pop(value));
+            CHECK(value == round * 4 + i);
+        }
+        CHECK(queue.empty());
+        CHECK_FALSE(queue.try_pop(value));
+    }
+}
+
+/**
+Validates that SpscQueue<> destroys remaining elements
+*/
+TEST_CASE("SpscQueue<>::~SpscQueue()", "[SpscQueue]")
+{
+    auto spCounter = std::make_shared<int>(0);
+    {
+        SpscQueue<std::shared_ptr<int>> queue(8);
+        for (int i = 0; i < 8; ++i) {
+            CHECK(queue.try_push(spCounter));
+        }
+        std::shared_ptr<int> spValue;
+        CHECK(queue.try_pop(spValue));
+        spValue.reset();
+        CHECK(spCounter.use_count() == 8);
+    }
+    CHECK(spCounter.use_count() == 1);
+}
+
+/**
+Validates that SpscQueue<> delivers every element in order with a concurrent producer and consumer
+*/
+TEST_CASE("SpscQueue<> (concurrent producer and consumer)", "[SpscQueue]")
+{
+    SpscQueue<int> queue(64);
+    std::thread producer(
+        [&]()
+        {
+            for (int i = 0; i < TestCount; ++i) {
+                while (!queue.try_push(i)) {
+                    std::this_thread::yield();
+                }
+            }
+        }
+    );
+    int errorCount = 0;
+    int value = 0;
+    for (int i = 0; i < TestCount; ++i) {
+        while (!queue.try_pop(value)) {
+            std::this_thread::yield();
+        }
+        errorCount += value != i;
+    }
+    producer.join();
+    CHECK(errorCount == 0);
+    CHECK(queue.empty());
+}
+
+} // namespace tests
+} // namespace dst
@@ -0,0 +1,191 @@
+/*
+==========================================
+  Copyright (c) 2020 Dynamic_Static
+    Patrick Purcell
+      Licensed under the MIT license
+    http://opensource.org/licenses/MIT
+==========================================
+*/
+
+#include "dynamic_static/core/delegate.hpp"
+#include "dynamic_static/core/subscribable.hpp"
+#include "dynamic_static/core/time.hpp"
+
+#include "catch2/catch.hpp"
+
+#include <iostream>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace dst {
+namespace benchmarks {
+
+static constexpr int DispatchCount { 1000000 };
+static constexpr int SubscribeCount { 100000 };
+
+/**
+Subscribable backed by std::set<>, the way Subscribable was implemented before, used as a baseline
+*/
+class SetSubscribable final
+{
+public:
+    SetSubscribable() = default;
+
+    inline SetSubscribable(SetSubscribable&& other) noexcept
+    {
+        *this = std::move(other);
+    }
+
+    inline ~SetSubscribable()
+    {
+        for (auto pSubscriber : mSubscribers) {
+            pSubscriber->mSubscriptions.erase(this);
+        }
+        for (auto pSubscription : mSubscriptions) {
+            pSubscription->mSubscribers.erase(this);
+        }
+    }
+
+    inline SetSubscribable& operator=(SetSubscribable&& other) noexcept
+    {
+        mSubscribers = std::move(other.mSubscribers);
+        mSubscriptions = std::move(other.mSubscriptions);
+        return *this;
+    }
+
+    inline SetSubscribable& operator+=(SetSubscribable& subscriber)
+    {
+        mSubscribers.insert(&subscriber);
+        subscriber.mSubscriptions.insert(this);
+        return *this;
+    }
+
+    inline SetSubscribable& operator-=(SetSubscribable& subscriber)
+    {
+        subscriber.mSubscriptions.erase(this);
+        mSubscribers.erase(&subscriber);
+        return *this;
+    }
+
+    inline const std::set<SetSubscribable*>& get_subscribers() const
+    {
+        return mSubscribers;
+    }
+
+private:
+    std::set<SetSubscribable*> mSubscribers;
+    std::set<SetSubscribable*> mSubscriptions;
+};
+
+/**
+Measures subscribing, iterating over, and unsubscribing a specified number of subscribers with a given Subscribable type
+@param <SubscribableType> The type of Subscribable to measure
+@param <UnsubscribeFunctionType> The type of function used to unsubscribe
+@param [in] name The name to report
+@param [in] subscriberCount The number of subscribers
+@param [in] unsubscribe The function used to subscribe and unsubscribe all subscribers
+@return The number of subscribers visited
+*/
+template <typename SubscribableType, typename UnsubscribeFunctionType>
+static long long measure(const std::string& name, int subscriberCount, UnsubscribeFunctionType unsubscribe)
+{
+    Timer timer;
+    for (int i = 0; i < SubscribeCount / subscriberCount; ++i) {
+        SubscribableType subscribable;
+        std::vector<SubscribableType> subscribers(subscriberCount);
+        unsubscribe(subscribable, subscribers);
+    }
+    auto subscribeMilliseconds = timer.total<Milliseconds<>>();
+    SubscribableType subscribable;
+    std::vector<SubscribableType> subscribers(subscriberCount);
+    for (auto& subscriber : subscribers) {
+        subscribable += subscriber;
+    }
+    long long visitCount = 0;
+    timer.reset();
+    for (int i = 0; i < DispatchCount / subscriberCount; ++i) {
+        for (auto pSubscriber : subscribable.get_subscribers()) {
+            visitCount += pSubscriber != nullptr ? 1 : 0;
+        }
+    }
+    auto iterateMilliseconds = timer.total<Milliseconds<>>();
+    std::cout << name << " (" << subscriberCount << " subscribers) : subscribe/unsubscribe " << subscribeMilliseconds << " ms, iterate " << iterateMilliseconds << " ms" << std::endl;
+    return visitCount;
+}
+
+/**
+Compares Subscribable with a std::set<> backed Subscribable
+    @note Benchmarks are hidden, run with [benchmark] to include them
+*/
+TEST_CASE("Subscribable vs std::set<>", "[.][benchmark][Subscribable]")
+{
+    for (int subscriberCount : { 1, 4, 16, 64, 1024 }) {
+        auto expectedVisitCount = (long long)(DispatchCount / subscriberCount) * subscriberCount;
+        auto unsubscribeAll = [](auto& subscribable, auto& subscribers)
+        {
+            for (auto& subscriber : subscribers) {
+                subscribable += subscriber;
+            }
+            for (auto& subscriber : subscribers) {
+                subscribable -= subscriber;
+            }
+        };
+        auto destroyAll = [](auto& subscribable, auto& subscribers)
+        {
+            for (auto& subscriber : subscribers) {
+                subscribable += subscriber;
+            }
+            subscribers.clear();
+        };
+        CHECK(measure<Subscribable>("Subscribable (operator-=())", subscriberCount, unsubscribeAll) == expectedVisitCount);
+        CHECK(measure<Subscribable>("Subscribable (Subscription)", subscriberCount,
+            [](Subscribable& subscribable, std::vector<Subscribable>& subscribers)
+            {
+                std::vector<Subscription> subscriptions;
+                subscriptions.reserve(subscribers.size());
+                for (auto& subscriber : subscribers) {
+                    subscriptions.push_back(subscribable.subscribe(subscriber));
+                }
+            }
+        ) == expectedVisitCount);
+        CHECK(measure<Subscribable>("Subscribable (destroy)", subscriberCount, destroyAll) == expectedVisitCount);
+        CHECK(measure<Subscribable>("Subscribable (clear(begin, end))", subscriberCount,
+            [](Subscribable& subscribable, std::vector<Subscribable>& subscribers)
+            {
+                for (auto& subscriber : subscribers) {
+                    subscribable += subscriber;
+                }
+                Subscribable::clear(subscribers.begin(), subscribers.end());
+                Subscribable::clear(&subscribable, &subscribable + 1);
+            }
+        ) == expectedVisitCount);
+        CHECK(measure<SetSubscribable>("std::set<> (operator-=())", subscriberCount, unsubscribeAll) == expectedVisitCount);
+        CHECK(measure<SetSubscribable>("std::set<> (destroy)", subscriberCount, destroyAll) == expectedVisitCount);
+    }
+}
+
+/**
+Measures calling a Delegate<> with a few subscribed Delegate<> objects
+    @note Benchmarks are hidden, run with [benchmark] to include them
+*/
+TEST_CASE("Delegate<>::operator() (subscribers)", "[.][benchmark][Delegate<>]")
+{
+    int count = 0;
+    Delegate<int> delegate;
+    std::vector<Delegate<int>> subscribers(4);
+    for (auto& subscriber : subscribers) {
+        subscriber = [&](int value) { count += value; };
+        delegate += subscriber;
+    }
+    Timer timer;
+    for (int i = 0; i < DispatchCount; ++i) {
+        delegate(1);
+    }
+    std::cout << "Delegate<>::operator() (" << subscribers.size() << " subscribers) : " << timer.total<Milliseconds<>>() << " ms" << std::endl;
+    CHECK(count == DispatchCount * (int)subscribers.size());
+}
+
+} // namespace benchmarks
+} // namespace dst
@@ -114,5 +114,72 @@ TEST_CASE("Subscribable::~Subscribable()", "[Subscribable]")
     CHECK(subscribable.get_subscribers().empty());
 }
 
+/**
+Validates that Subscription removes its subscription when it's destroyed or reset
+*/
+TEST_CASE("Subscribable::subscribe()", "[Subscribable]")
+{
+    Subscribable subscribable;
+    std::vector<Subscribable> subscribers(TestCount);
+    std::vector<Subscription> subscriptions;
+    for (auto& subscriber : subscribers) {
+        subscriptions.push_back(subscribable.subscribe(subscriber));
+        CHECK(subscriptions.back().is_subscribed());
+    }
+    CHECK(!subscribable.subscribe(subscribers[0]).is_subscribed());
+    CHECK(!subscribable.subscribe(subscribable).is_subscribed());
+    CHECK(subscribable.get_subscribers().size() == subscribers.size());
+    subscriptions[1].reset();
+    subscriptions.erase(subscriptions.begin() + 2);
+    CHECK(!subscribable.get_subscribers().count(&subscribers[1]));
+    CHECK(!subscribable.get_subscribers().count(&subscribers[2]));
+    CHECK(!subscribers[1].get_subscriptions().count(&subscribable));
+    CHECK(subscribable.get_subscribers().size() == subscribers.size() - 2);
+    SECTION("Subscribable moved")
+    {
+        auto movedSubscribable = std::move(subscribable);
+        subscriptions[0].reset();
+        CHECK(!movedSubscribable.get_subscribers().count(&subscribers[0]));
+        CHECK(movedSubscribable.get_subscribers().size() == subscribers.size() - 3);
+    }
+    SECTION("Subscription outlives its subscriber")
+    {
+        subscribers.clear();
+        for (const auto& subscription : subscriptions) {
+            CHECK(!subscription.is_subscribed());
+        }
+        CHECK(subscribable.get_subscribers().empty());
+    }
+    SECTION("Subscription outlives its Subscribable")
+    {
+        {
+            Subscribable temporary;
+            subscriptions[0] = temporary.subscribe(subscribers[0]);
+        }
+        CHECK(!subscriptions[0].is_subscribed());
+    }
+}
+
+/**
+Validates that Subscribable::clear() removes subscriptions within and outside of a range of Subscribable objects
+*/
+TEST_CASE("Subscribable::clear(begin, end)", "[Subscribable]")
+{
+    Subscribable outside;
+    std::vector<Subscribable> subscribables(TestCount);
+    randomize_subscriptions(subscribables);
+    for (auto& subscribable : subscribables) {
+        outside += subscribable;
+        subscribable += outside;
+    }
+    Subscribable::clear(subscribables.begin(), subscribables.end());
+    for (const auto& subscribable : subscribables) {
+        CHECK(subscribable.get_subscribers().empty());
+        CHECK(subscribable.get_subscriptions().empty());
+    }
+    CHECK(outside.get_subscribers().empty());
+    CHECK(outside.get_subscriptions().empty());
+}
+
 } // namespace tests
 } // namespace dst
@@ -0,0 +1,129 @@
+/*
+==========================================
+  Copyright (c) 2020 Dynamic_Static
+    Patrick Purcell
+      Licensed under the MIT license
+    http://opensource.org/licenses/MIT
+==========================================
+*/
+
+#include "dynamic_static/core/task-graph.hpp"
+#include "dynamic_static/core/thread-pool.hpp"
+
+#include "catch2/catch.hpp"
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+namespace dst {
+namespace tests {
+
+static constexpr int TestCount { 64 };
+
+/**
+Validates that TaskGraph processes tasks after their predecessors
+*/
+TEST_CASE("TaskGraph::run()", "[TaskGraph]")
+{
+    ThreadPool threadPool;
+    TaskGraph taskGraph;
+    std::atomic_int step { 0 };
+    std::vector<int> steps(TestCount + 3, -1);
+    auto a = taskGraph.add_task([&]() { steps[0] = step++; });
+    auto b = taskGraph.add_task([&]() { steps[1] = step++; });
+    auto c = taskGraph.add_task([&]() { steps[2] = step++; });
+    taskGraph.add_dependency(a, c);
+    taskGraph.add_dependency(b, c);
+    for (size_t i = 0; i < TestCount; ++i) {
+        auto task = taskGraph.add_task([&, i]() { steps[3 + i] = step++; });
+        taskGraph.add_dependency(c, task);
+    }
+    for (int run = 0; run < 8; ++run) {
+        step = 0;
+        taskGraph.run(threadPool);
+        CHECK(step == TestCount + 3);
+        CHECK(steps[2] > steps[0]);
+        CHECK(steps[2] > steps[1]);
+        for (size_t i = 0; i < TestCount; ++i) {
+            if (steps[3 + i] < steps[2]) {
+                FAIL();
+            }
+        }
+    }
+}
+
+/**
+Validates that TaskGraph processes a long chain of tasks in order
+*/
+TEST_CASE("TaskGraph::run() (chain)", "[TaskGraph]")
+{
+    ThreadPool threadPool;
+    TaskGraph taskGraph;
+    std::vector<int> values;
+    for (int i = 0; i < TestCount; ++i) {
+        auto task = taskGraph.add_task([&, i]() { values.push_back(i); });
+        if (i) {
+            taskGraph.add_dependency(task - 1, task);
+        }
+    }
+    taskGraph.run(threadPool);
+    REQUIRE(values.size() == TestCount);
+    for (int i = 0; i < TestCount; ++i) {
+        if (values[i] != i) {
+            FAIL();
+        }
+    }
+}
+
+/**
+Validates that TaskGraph rethrows exceptions after processing all tasks
+*/
+TEST_CASE("TaskGraph::run() (exceptions)", "[TaskGraph]")
+{
+    ThreadPool threadPool;
+    TaskGraph taskGraph;
+    std::atomic_int count { 0 };
+    auto a = taskGraph.add_task([&]() { ++count; throw std::runtime_error("TaskGraph"); });
+    auto b = taskGraph.add_task([&]() { ++count; });
+    taskGraph.add_dependency(a, b);
+    CHECK_THROWS_AS(taskGraph.run(threadPool), std::runtime_error);
+    CHECK(count == 2);
+}
+
+/**
+Validates that TaskGraph::run() returns when ThreadPool::clear() drops its tasks and skips tasks that depend on dropped tasks
+*/
+TEST_CASE("TaskGraph::run() (ThreadPool::clear())", "[TaskGraph]")
+{
+    ThreadPool threadPool(0);
+    TaskGraph taskGraph;
+    bool clear = true;
+    std::atomic_int rootCount { 0 };
+    std::atomic_int count { 0 };
+    auto rootTask = [&]()
+    {
+        ++rootCount;
+        if (clear) {
+            threadPool.clear();
+        }
+    };
+    auto a = taskGraph.add_task(rootTask);
+    auto b = taskGraph.add_task(rootTask);
+    auto c = taskGraph.add_task([&]() { ++count; });
+    auto d = taskGraph.add_task([&]() { ++count; });
+    taskGraph.add_dependency(a, c);
+    taskGraph.add_dependency(b, c);
+    taskGraph.add_dependency(c, d);
+    taskGraph.run(threadPool);
+    CHECK(rootCount == 1);
+    CHECK(count == 0);
+    clear = false;
+    rootCount = 0;
+    taskGraph.run(threadPool);
+    CHECK(rootCount == 2);
+    CHECK(count == 2);
+}
+
+} // namespace tests
+} // namespace dst
@@ -0,0 +1,109 @@
+/*
+==========================================
+  Copyright (c) 2020 Dynamic_Static
+    Patrick Purcell
+      Licensed under the MIT license
+    http://opensource.org/licenses/MIT
+==========================================
+*/
+
+#include "dynamic_static/core/task-group.hpp"
+#include "dynamic_static/core/thread-pool.hpp"
+
+#include "catch2/catch.hpp"
+
+#include <atomic>
+#include <future>
+#include <stdexcept>
+
+namespace dst {
+namespace tests {
+
+static constexpr int TestCount { 256 };
+
+/**
+Validates that TaskGroup::wait() only waits for its own tasks
+*/
+TEST_CASE("TaskGroup::wait()", "[TaskGroup]")
+{
+    ThreadPool threadPool(2);
+    std::promise<void> blocker;
+    std::promise<void> blockerStarted;
+    auto blockerFuture = blocker.get_future().share();
+    TaskGroup blockedTaskGroup(threadPool);
+    blockedTaskGroup.push([&blockerStarted, blockerFuture]() { blockerStarted.set_value(); blockerFuture.wait(); });
+    // NOTE : The blocking task must be running on a ThreadPool thread before the
+    //  calling thread starts processing pending tasks in TaskGroup::wait().
+    blockerStarted.get_future().wait();
+    std::atomic_int count { 0 };
+    TaskGroup taskGroup(threadPool);
+    for (int i = 0; i < TestCount; ++i) {
+        taskGroup.push([&]() { ++count; });
+    }
+    taskGroup.wait();
+    CHECK(count == TestCount);
+    CHECK(taskGroup.get_task_count() == 0);
+    CHECK(blockedTaskGroup.get_task_count() == 1);
+    blocker.set_value();
+    blockedTaskGroup.wait();
+    CHECK(blockedTaskGroup.get_task_count() == 0);
+}
+
+/**
+Validates that TaskGroup::wait() can be called from ThreadPool threads
+*/
+TEST_CASE("TaskGroup::wait() (nested)", "[TaskGroup]")
+{
+    ThreadPool threadPool(1);
+    std::atomic_int count { 0 };
+    TaskGroup taskGroup(threadPool);
+    for (int i = 0; i < 4; ++i) {
+        taskGroup.push(
+            [&]()
+            {
+                TaskGroup nestedTaskGroup(threadPool);
+                for (int j = 0; j < TestCount; ++j) {
+                    nestedTaskGroup.push([&]() { ++count; });
+                }
+                nestedTaskGroup.wait();
+            }
+        );
+    }
+    taskGroup.wait();
+    CHECK(count == 4 * TestCount);
+}
+
+/**
+Validates that TaskGroup::wait() rethrows exceptions
+*/
+TEST_CASE("TaskGroup::wait() (exceptions)", "[TaskGroup]")
+{
+    ThreadPool threadPool;
+    TaskGroup taskGroup(threadPool);
+    taskGroup.push([]() { throw std::runtime_error("TaskGroup"); });
+    CHECK_THROWS_AS(taskGroup.wait(), std::runtime_error);
+    CHECK_NOTHROW(taskGroup.wait());
+}
+
+/**
+Validates that TaskGroup::wait() doesn't wait for tasks dropped by cancellation
+*/
+TEST_CASE("TaskGroup::wait() (cancellation)", "[TaskGroup]")
+{
+    ThreadPool threadPool(0);
+    std::atomic_int count { 0 };
+    CancellationSource cancellationSource;
+    ThreadPool::PushInfo pushInfo { };
+    pushInfo.cancellationToken = cancellationSource.get_token();
+    TaskGroup taskGroup(threadPool);
+    for (int i = 0; i < TestCount; ++i) {
+        taskGroup.push([&]() { ++count; }, i % 2 ? pushInfo : ThreadPool::PushInfo { });
+    }
+    cancellationSource.cancel();
+    taskGroup.wait();
+    CHECK(count == TestCount / 2);
+    CHECK(taskGroup.get_task_count() == 0);
+}
+
+} // namespace tests
+} // namespace dst
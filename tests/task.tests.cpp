@@ -0,0 +1,125 @@
+/*
+==========================================
+  Copyright (c) 2020 Dynamic_Static
+    Patrick Purcell
+      Licensed under the MIT license
+    http://opensource.org/licenses/MIT
+==========================================
+*/
+
+#include "dynamic_static/core/task.hpp"
+#include "dynamic_static/core/thread-pool.hpp"
+
+#if defined(DYNAMIC_STATIC_COROUTINES_ENABLED)
+
+#include "catch2/catch.hpp"
+
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace dst {
+namespace tests {
+
+static constexpr int TestCount { 256 };
+
+static Task<int> make_value(ThreadPool& threadPool, int value)
+{
+    co_await threadPool.schedule();
+    co_return value;
+}
+
+static Task<int> sum_values(ThreadPool& threadPool, int count)
+{
+    co_await threadPool.schedule();
+    std::vector<Task<int>> tasks;
+    for (int i = 0; i < count; ++i) {
+        tasks.push_back(make_value(threadPool, i));
+    }
+    int sum = 0;
+    for (auto& task : tasks) {
+        sum += co_await std::move(task);
+    }
+    co_return sum;
+}
+
+/**
+Validates that ThreadPool::schedule() resumes coroutines on ThreadPool threads
+*/
+TEST_CASE("ThreadPool::schedule()", "[Task]")
+{
+    ThreadPool threadPool(2);
+    auto callingThreadId = std::this_thread::get_id();
+    auto task = [&]() -> Task<std::thread::id>
+    {
+        co_await threadPool.schedule();
+        co_return std::this_thread::get_id();
+    };
+    std::thread::id threadId;
+    std::thread([&]() { threadId = sync_wait(threadPool, task()); }).join();
+    CHECK(threadId != callingThreadId);
+}
+
+/**
+Validates that Task<> objects can be awaited from other Task<> objects
+*/
+TEST_CASE("Task<> (co_await)", "[Task]")
+{
+    ThreadPool threadPool;
+    CHECK(sync_wait(threadPool, sum_values(threadPool, TestCount)) == TestCount * (TestCount - 1) / 2);
+    std::atomic_int count { 0 };
+    auto increment = [&]() -> Task<>
+    {
+        co_await threadPool.schedule();
+        ++count;
+    };
+    auto incrementAll = [&]() -> Task<>
+    {
+        for (int i = 0; i < TestCount; ++i) {
+            co_await increment();
+        }
+    };
+    sync_wait(threadPool, incrementAll());
+    CHECK(count == TestCount);
+}
+
+/**
+Validates that sync_wait() can be called from ThreadPool threads without dead locking
+*/
+TEST_CASE("sync_wait() (nested)", "[Task]")
+{
+    ThreadPool threadPool(1);
+    auto future = threadPool.push([&]() { return sync_wait(threadPool, sum_values(threadPool, TestCount)); });
+    CHECK(future.get() == TestCount * (TestCount - 1) / 2);
+}
+
+/**
+Validates that exceptions thrown by Task<> objects are rethrown to awaiting coroutines
+*/
+TEST_CASE("Task<> (exceptions)", "[Task]")
+{
+    ThreadPool threadPool;
+    auto fail = [&]() -> Task<std::string>
+    {
+        co_await threadPool.schedule();
+        throw std::runtime_error("Task<>");
+    };
+    auto rethrow = [&]() -> Task<bool>
+    {
+        try {
+            co_await fail();
+        } catch (const std::runtime_error&) {
+            co_return true;
+        }
+        co_return false;
+    };
+    CHECK(sync_wait(threadPool, rethrow()));
+    CHECK_THROWS_AS(sync_wait(threadPool, fail()), std::runtime_error);
+}
+
+} // namespace tests
+} // namespace dst
+
+#endif // DYNAMIC_STATIC_COROUTINES_ENABLED
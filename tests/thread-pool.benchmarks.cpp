@@ -0,0 +1,210 @@
+/*
+==========================================
+  Copyright (c) 2020 Dynamic_Static
+    Patrick Purcell
+      Licensed under the MIT license
+    http://opensource.org/licenses/MIT
+==========================================
+*/
+
+#include "dynamic_static/core/thread-pool.hpp"
+#include "dynamic_static/core/time.hpp"
+
+#include "catch2/catch.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace dst {
+namespace benchmarks {
+
+static constexpr int TaskCount { 1000000 };
+
+static void report(const std::string& name, double totalMilliseconds, int count)
+{
+    std::cout << name << " : " << totalMilliseconds << " ms (" << totalMilliseconds * 1000000.0 / count << " ns/task)" << std::endl;
+}
+
+/**
+Compares ThreadPool::push() and ThreadPool::push_detached() submission throughput
+    @note Benchmarks are hidden, run with [benchmark] to include them
+*/
+TEST_CASE("ThreadPool::push() vs ThreadPool::push_detached()", "[.][benchmark][ThreadPool]")
+{
+    ThreadPool threadPool;
+    std::atomic_int counter { 0 };
+    SECTION("push()")
+    {
+        Timer timer;
+        for (int i = 0; i < TaskCount; ++i) {
+            threadPool.push([&]() { counter.fetch_add(1, std::memory_order_relaxed); });
+        }
+        threadPool.wait();
+        report("push()", timer.total<Milliseconds<>>(), TaskCount);
+    }
+    SECTION("push_detached()")
+    {
+        Timer timer;
+        for (int i = 0; i < TaskCount; ++i) {
+            threadPool.push_detached([&]() { counter.fetch_add(1, std::memory_order_relaxed); });
+        }
+        threadPool.wait();
+        report("push_detached()", timer.total<Milliseconds<>>(), TaskCount);
+    }
+    SECTION("push_detached() (from ThreadPool threads)")
+    {
+        Timer timer;
+        auto taskCountPerThread = TaskCount / (int)threadPool.get_thread_count();
+        for (size_t i = 0; i < threadPool.get_thread_count(); ++i) {
+            threadPool.push_detached(
+                [&]()
+                {
+                    for (int j = 0; j < taskCountPerThread; ++j) {
+                        threadPool.push_detached([&]() { counter.fetch_add(1, std::memory_order_relaxed); });
+                    }
+                }
+            );
+        }
+        threadPool.wait();
+        report("push_detached() (from ThreadPool threads)", timer.total<Milliseconds<>>(), TaskCount);
+    }
+    CHECK(counter);
+}
+
+/**
+Compares submitting tasks individually with ThreadPool::push_batch()
+    @note Benchmarks are hidden, run with [benchmark] to include them
+*/
+TEST_CASE("ThreadPool::push() vs ThreadPool::push_batch()", "[.][benchmark][ThreadPool]")
+{
+    ThreadPool threadPool;
+    std::atomic_int counter { 0 };
+    SECTION("push()")
+    {
+        Timer timer;
+        for (int i = 0; i < TaskCount; ++i) {
+            threadPool.push([&]() { counter.fetch_add(1, std::memory_order_relaxed); });
+        }
+        threadPool.wait();
+        report("push()", timer.total<Milliseconds<>>(), TaskCount);
+    }
+    SECTION("push_batch()")
+    {
+        Timer timer;
+        threadPool.push_batch(TaskCount, [&](size_t) { counter.fetch_add(1, std::memory_order_relaxed); }).wait();
+        report("push_batch()", timer.total<Milliseconds<>>(), TaskCount);
+    }
+    CHECK(counter);
+}
+
+/**
+Measures the latency from push to processing of High Priority tasks while a ThreadPool is saturated with Low Priority tasks
+    @note Benchmarks are hidden, run with [benchmark] to include them
+*/
+TEST_CASE("ThreadPool::push() (High Priority latency under saturation)", "[.][benchmark][ThreadPool]")
+{
+    static constexpr int BackgroundTaskCount { 200000 };
+    static constexpr int LatencyTaskCount { 1000 };
+    auto busy_wait = [](Microseconds<> duration)
+    {
+        Timer timer;
+        while (timer.total<Microseconds<>>() < duration.count()) {
+        }
+    };
+    auto measure = [&](ThreadPool::Priority priority)
+    {
+        ThreadPool threadPool;
+        threadPool.push_batch(BackgroundTaskCount, [&](size_t) { busy_wait(Microseconds<> { 2 }); }, { ThreadPool::Priority::Low });
+        std::vector<double> latencies(LatencyTaskCount);
+        for (int i = 0; i < LatencyTaskCount; ++i) {
+            auto pushTime = HighResolutionClock::now();
+            threadPool.push_detached(
+                [&latencies, i, pushTime]()
+                {
+                    latencies[i] = duration_cast<Microseconds<>>(HighResolutionClock::now() - pushTime).count();
+                },
+                { priority }
+            );
+            busy_wait(Microseconds<> { 20 });
+        }
+        threadPool.wait();
+        std::sort(latencies.begin(), latencies.end());
+        std::cout << (priority == ThreadPool::Priority::High ? "High" : "Low") << " Priority latency : "
+            << "p50 " << latencies[LatencyTaskCount / 2] << " us, "
+            << "p99 " << latencies[LatencyTaskCount * 99 / 100] << " us, "
+            << "max " << latencies.back() << " us" << std::endl;
+    };
+    measure(ThreadPool::Priority::Low);
+    measure(ThreadPool::Priority::High);
+}
+
+/**
+Measures the latency from push to processing of tasks pushed in short bursts with each idle policy
+    @note Benchmarks are hidden, run with [benchmark] to include them
+*/
+TEST_CASE("ThreadPool::CreateInfo (idle policy latency)", "[.][benchmark][ThreadPool]")
+{
+    static constexpr int BurstCount { 2000 };
+    static constexpr int BurstTaskCount { 8 };
+    auto measure = [](const char* pName, Microseconds<> spinDuration, Microseconds<> yieldDuration)
+    {
+        ThreadPool::CreateInfo createInfo { };
+        createInfo.spinDuration = spinDuration;
+        createInfo.yieldDuration = yieldDuration;
+        ThreadPool threadPool(createInfo);
+        std::vector<double> latencies;
+        latencies.reserve(BurstCount);
+        for (int i = 0; i < BurstCount; ++i) {
+            std::atomic_int remaining { BurstTaskCount };
+            auto pushTime = HighResolutionClock::now();
+            for (int j = 0; j < BurstTaskCount; ++j) {
+                threadPool.push_detached([&]() { remaining.fetch_sub(1, std::memory_order_release); });
+            }
+            while (remaining.load(std::memory_order_acquire)) {
+            }
+            latencies.push_back(duration_cast<Microseconds<>>(HighResolutionClock::now() - pushTime).count());
+            threadPool.wait();
+            std::this_thread::sleep_for(Microseconds<> { 20 });
+        }
+        std::sort(latencies.begin(), latencies.end());
+        std::cout << pName << " burst latency : "
+            << "p50 " << latencies[BurstCount / 2] << " us, "
+            << "p99 " << latencies[BurstCount * 99 / 100] << " us, "
+            << "max " << latencies.back() << " us" << std::endl;
+    };
+    measure("Block", Microseconds<> { 0 }, Microseconds<> { 0 });
+    measure("Spin then block", Microseconds<> { 100 }, Microseconds<> { 0 });
+    measure("Spin then yield then block", Microseconds<> { 50 }, Microseconds<> { 200 });
+}
+
+/**
+Measures the cost of creating and cancelling many ThreadPool::push_after() timers
+    @note Benchmarks are hidden, run with [benchmark] to include them
+*/
+TEST_CASE("ThreadPool::push_after() (timer creation and cancellation)", "[.][benchmark][ThreadPool]")
+{
+    static constexpr int TimerCount { 100000 };
+    ThreadPool threadPool;
+    std::atomic_int counter { 0 };
+    std::vector<ThreadPool::TimerId> timerIds;
+    timerIds.reserve(TimerCount);
+    Timer timer;
+    for (int i = 0; i < TimerCount; ++i) {
+        timerIds.push_back(threadPool.push_after(Seconds<> { 1.0 + i % 3600 }, [&]() { counter.fetch_add(1, std::memory_order_relaxed); }));
+    }
+    report("push_after()", timer.total<Milliseconds<>>(), TimerCount);
+    timer.reset();
+    for (auto timerId : timerIds) {
+        threadPool.cancel_timer(timerId);
+    }
+    report("cancel_timer()", timer.total<Milliseconds<>>(), TimerCount);
+    CHECK(threadPool.get_timer_count() == 0);
+    CHECK(counter == 0);
+}
+
+} // namespace benchmarks
+} // namespace dst
@@ -13,7 +13,12 @@
 
 #include "catch2/catch.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <memory>
 #include <future>
+#include <stdexcept>
 #include <string>
 #include <vector>
 
@@ -33,6 +38,36 @@ static std::string make_word(size_t index)
     return sWords[index % sWords.size()] + "[" + std::to_string(index) + "]";
 }
 
+/**
+Pushes a task for each of a given ThreadPool object's threads that blocks its thread until a given std::shared_future<> is ready
+@param [in] threadPool The ThreadPool whose threads to block
+@param [in] release The std::shared_future<> that releases the blocked threads
+    @note This function returns once every thread is blocked
+*/
+static void block_threads(ThreadPool& threadPool, std::shared_future<void> release)
+{
+    struct BlockedState final
+    {
+        std::atomic_size_t count { 0 };
+        std::promise<void> promise;
+    };
+    auto threadCount = threadPool.get_thread_count();
+    auto spBlockedState = std::make_shared<BlockedState>();
+    auto blocked = spBlockedState->promise.get_future();
+    for (size_t i = 0; i < threadCount; ++i) {
+        threadPool.push_detached(
+            [spBlockedState, release, threadCount]()
+            {
+                if (++spBlockedState->count == threadCount) {
+                    spBlockedState->promise.set_value();
+                }
+                release.wait();
+            }
+        );
+    }
+    blocked.wait();
+}
+
 /**
 Validates that wait() doesn't dead lock when there are no tasks
 */
@@ -75,7 +110,7 @@ TEST_CASE("ThreadPool::push() (multiple tasks)", "[ThreadPool]")
 {
     ThreadPool threadPool;
     std::vector<std::string> taskResults(TestCount);
-    std::vector<std::future<void>> futures(TestCount);
+    std::vector<Future<void>> futures(TestCount);
     threadPool.push([]() { std::this_thread::sleep_for(Seconds<> { 0.25 }); });
     for (size_t i = 0; i < TestCount; ++i) {
         auto future = threadPool.push(
@@ -106,16 +141,623 @@ TEST_CASE("ThreadPool::push() (multiple tasks)", "[ThreadPool]")
     }
 }
 
+/**
+Validates that Future<> objects returned by push() provide tasks' results
+*/
+TEST_CASE("ThreadPool::push() (results)", "[ThreadPool]")
+{
+    ThreadPool threadPool;
+    std::vector<Future<std::string>> futures(TestCount);
+    for (size_t i = 0; i < TestCount; ++i) {
+        futures[i] = threadPool.push([i]() { return make_word(i); });
+    }
+    for (size_t i = 0; i < TestCount; ++i) {
+        REQUIRE(futures[i].valid());
+        if (futures[i].get() != make_word(i)) {
+            FAIL();
+        }
+        CHECK_FALSE(futures[i].valid());
+    }
+    int value = 0;
+    auto referenceFuture = threadPool.push([&]() -> int& { return value; });
+    CHECK(&referenceFuture.get() == &value);
+    auto exceptionFuture = threadPool.push([]() -> int { throw std::runtime_error("push()"); });
+    CHECK_THROWS_AS(exceptionFuture.get(), std::runtime_error);
+}
+
+/**
+Validates that Future<>::get() can be called from ThreadPool threads without dead locking
+*/
+TEST_CASE("ThreadPool::push() (nested Future<>::get())", "[ThreadPool]")
+{
+    ThreadPool threadPool(1);
+    auto future = threadPool.push(
+        [&]()
+        {
+            std::vector<Future<size_t>> futures(TestCount);
+            for (size_t i = 0; i < TestCount; ++i) {
+                futures[i] = threadPool.push([i]() { return i; });
+            }
+            size_t sum = 0;
+            for (auto& future : futures) {
+                sum += future.get();
+            }
+            return sum;
+        }
+    );
+    CHECK(future.get() == TestCount * (TestCount - 1) / 2);
+}
+
+/**
+Validates that Future<> objects associated with tasks removed by clear() report std::future_errc::broken_promise
+*/
+TEST_CASE("ThreadPool::clear()", "[ThreadPool]")
+{
+    ThreadPool threadPool(1);
+    std::promise<void> blocker;
+    std::promise<void> blockerStarted;
+    auto blockerFuture = blocker.get_future().share();
+    threadPool.push_detached([&blockerStarted, blockerFuture]() { blockerStarted.set_value(); blockerFuture.wait(); });
+    blockerStarted.get_future().wait();
+    auto future = threadPool.push([]() { return 0; });
+    auto batchFuture = threadPool.push_batch(TestCount, [](size_t) { });
+    threadPool.clear();
+    blocker.set_value();
+    CHECK_THROWS_AS(future.get(), std::future_error);
+    CHECK_THROWS_AS(batchFuture.get(), std::future_error);
+    threadPool.wait();
+}
+
+/**
+Validates that detached tasks can be pushed and executed
+*/
+TEST_CASE("ThreadPool::push_detached()", "[ThreadPool]")
+{
+    ThreadPool threadPool;
+    std::vector<std::string> taskResults(TestCount);
+    std::vector<std::string> largeTaskResults(TestCount);
+    for (size_t i = 0; i < TestCount; ++i) {
+        threadPool.push_detached([i, &taskResults]() { taskResults[i] = make_word(i); });
+        std::string word = make_word(i);
+        threadPool.push_detached([i, word, &largeTaskResults]() { largeTaskResults[i] = word; });
+    }
+    threadPool.wait();
+    for (size_t i = 0; i < TestCount; ++i) {
+        if (taskResults[i] != make_word(i) || largeTaskResults[i] != make_word(i)) {
+            FAIL();
+        }
+    }
+}
+
+/**
+Validates that batches of tasks can be pushed and executed
+*/
+TEST_CASE("ThreadPool::push_batch()", "[ThreadPool]")
+{
+    ThreadPool threadPool;
+    std::vector<std::string> taskResults(TestCount);
+    SECTION("push_batch(begin, end)")
+    {
+        std::vector<std::function<void()>> tasks;
+        for (size_t i = 0; i < TestCount; ++i) {
+            tasks.push_back([i, &taskResults]() { taskResults[i] = make_word(i); });
+        }
+        threadPool.push_batch(tasks.begin(), tasks.end()).wait();
+    }
+    SECTION("push_batch(count, task)")
+    {
+        threadPool.push_batch(TestCount, [&taskResults](size_t i) { taskResults[i] = make_word(i); }).wait();
+    }
+    for (size_t i = 0; i < TestCount; ++i) {
+        if (taskResults[i] != make_word(i)) {
+            FAIL();
+        }
+    }
+}
+
+/**
+Validates that an empty batch completes and that batch exceptions are reported
+*/
+TEST_CASE("ThreadPool::push_batch() (empty and throwing batches)", "[ThreadPool]")
+{
+    ThreadPool threadPool;
+    std::vector<std::function<void()>> tasks;
+    threadPool.push_batch(tasks.begin(), tasks.end()).get();
+    auto future = threadPool.push_batch(TestCount, [](size_t i) { if (i == TestCount / 2) { throw std::runtime_error("push_batch()"); } });
+    CHECK_THROWS_AS(future.get(), std::runtime_error);
+}
+
+/**
+Validates that higher Priority tasks are processed first and that lower Priority tasks aren't starved
+*/
+TEST_CASE("ThreadPool::push() (Priority)", "[ThreadPool]")
+{
+    ThreadPool threadPool(1);
+    std::promise<void> blocker;
+    auto blockerFuture = blocker.get_future().share();
+    threadPool.push([blockerFuture]() { blockerFuture.wait(); });
+    while (threadPool.get_active_thread_count() == 0) {
+        std::this_thread::yield();
+    }
+    std::vector<ThreadPool::Priority> processed;
+    auto push = [&](ThreadPool::Priority priority)
+    {
+        threadPool.push_detached([&processed, priority]() { processed.push_back(priority); }, { priority });
+    };
+    SECTION("High before Normal before Low")
+    {
+        push(ThreadPool::Priority::Low);
+        push(ThreadPool::Priority::Normal);
+        push(ThreadPool::Priority::High);
+        blocker.set_value();
+        threadPool.wait();
+        REQUIRE(processed.size() == 3);
+        CHECK(processed[0] == ThreadPool::Priority::High);
+        CHECK(processed[1] == ThreadPool::Priority::Normal);
+        CHECK(processed[2] == ThreadPool::Priority::Low);
+    }
+    SECTION("Low isn't starved")
+    {
+        push(ThreadPool::Priority::Low);
+        for (size_t i = 0; i < ThreadPool::StarvationInterval * 2; ++i) {
+            push(ThreadPool::Priority::High);
+        }
+        blocker.set_value();
+        threadPool.wait();
+        REQUIRE(processed.size() == ThreadPool::StarvationInterval * 2 + 1);
+        CHECK(processed.back() == ThreadPool::Priority::High);
+
+        // NOTE : The blocking task is the thread's first task, so the Low Priority
+        //  task is its StarvationInterval'th task regardless of how often it polled.
+        CHECK(processed[ThreadPool::StarvationInterval - 2] == ThreadPool::Priority::Low);
+    }
+}
+
+/**
+Validates that tasks pushed from ThreadPool threads are executed
+*/
+TEST_CASE("ThreadPool::push() (nested tasks)", "[ThreadPool]")
+{
+    ThreadPool threadPool;
+    std::vector<std::string> taskResults(TestCount * TestCount);
+    for (size_t i = 0; i < TestCount; ++i) {
+        threadPool.push(
+            [i, &threadPool, &taskResults]()
+            {
+                for (size_t j = 0; j < TestCount; ++j) {
+                    auto index = i * TestCount + j;
+                    threadPool.push([index, &taskResults]() { taskResults[index] = make_word(index); });
+                }
+            }
+        );
+    }
+    threadPool.wait();
+    for (size_t i = 0; i < taskResults.size(); ++i) {
+        if (taskResults[i] != make_word(i)) {
+            FAIL();
+        }
+    }
+}
+
+/**
+Validates that ThreadPool processes tasks pushed in bursts with each idle policy
+*/
+TEST_CASE("ThreadPool::CreateInfo (idle policy)", "[ThreadPool]")
+{
+    ThreadPool::CreateInfo createInfo { };
+    createInfo.threadCount = 2;
+    SECTION("Block")
+    {
+    }
+    SECTION("Spin then block")
+    {
+        createInfo.spinDuration = Microseconds<> { 100 };
+    }
+    SECTION("Spin then yield then block")
+    {
+        createInfo.spinDuration = Microseconds<> { 100 };
+        createInfo.yieldDuration = Microseconds<> { 100 };
+    }
+    ThreadPool threadPool(createInfo);
+    std::vector<std::string> taskResults(TestCount);
+    for (size_t i = 0; i < TestCount; ++i) {
+        threadPool.push([i, &taskResults]() { taskResults[i] = make_word(i); });
+        if (!(i % 16)) {
+            threadPool.wait();
+            std::this_thread::sleep_for(Microseconds<> { 50 });
+        }
+    }
+    threadPool.wait();
+    for (size_t i = 0; i < taskResults.size(); ++i) {
+        if (taskResults[i] != make_word(i)) {
+            FAIL();
+        }
+    }
+}
+
+/**
+Validates that ThreadPool processes tasks queued on each node with each Affinity
+*/
+TEST_CASE("ThreadPool::CreateInfo (affinity)", "[ThreadPool]")
+{
+    ThreadPool::CreateInfo createInfo { };
+    createInfo.threadCount = 4;
+    SECTION("Affinity::None")
+    {
+        createInfo.affinity = ThreadPool::Affinity::None;
+    }
+    SECTION("Affinity::Node")
+    {
+        createInfo.affinity = ThreadPool::Affinity::Node;
+    }
+    SECTION("Affinity::Core")
+    {
+        createInfo.affinity = ThreadPool::Affinity::Core;
+    }
+    ThreadPool threadPool(createInfo);
+    REQUIRE(threadPool.get_thread_count() == 4);
+    REQUIRE(threadPool.get_node_count());
+    if (createInfo.affinity == ThreadPool::Affinity::None) {
+        CHECK(threadPool.get_node_count() == 1);
+    }
+    auto nodeCount = threadPool.get_node_count() + 1;
+    std::vector<std::string> taskResults(TestCount * nodeCount);
+    for (size_t node = 0; node < nodeCount; ++node) {
+        ThreadPool::PushInfo pushInfo { };
+        pushInfo.node = node < threadPool.get_node_count() ? node : ThreadPool::AnyNode;
+        for (size_t i = 0; i < TestCount; ++i) {
+            auto index = node * TestCount + i;
+            threadPool.push_detached([index, &taskResults]() { taskResults[index] = make_word(index); }, pushInfo);
+        }
+    }
+    threadPool.wait();
+    for (size_t i = 0; i < taskResults.size(); ++i) {
+        if (taskResults[i] != make_word(i)) {
+            FAIL();
+        }
+    }
+}
+
+/**
+Validates that ThreadPool::get_statistics() reports processed tasks
+*/
+TEST_CASE("ThreadPool::get_statistics()", "[ThreadPool]")
+{
+    ThreadPool::CreateInfo createInfo { };
+    createInfo.threadCount = 2;
+    SECTION("Timing statistics disabled")
+    {
+        createInfo.timingStatisticsEnabled = false;
+    }
+    SECTION("Timing statistics enabled")
+    {
+        createInfo.timingStatisticsEnabled = true;
+    }
+    ThreadPool threadPool(createInfo);
+    std::promise<void> release;
+    block_threads(threadPool, release.get_future().share());
+    auto future = threadPool.push_batch(
+        TestCount,
+        [](size_t)
+        {
+            Timer timer;
+            while (!timer.total<Nanoseconds<>>()) {
+                std::this_thread::yield();
+            }
+        }
+    );
+    CHECK(threadPool.get_task_count() == TestCount);
+    release.set_value();
+    future.get();
+    threadPool.wait();
+    auto statistics = threadPool.get_statistics();
+    REQUIRE(statistics.threads.size() == threadPool.get_thread_count());
+    uint64_t executedTaskCount = statistics.otherThreads.executedTaskCount;
+    uint64_t queueHighWaterMark = 0;
+    double busyNanoseconds = statistics.otherThreads.busyDuration.count();
+    for (const auto& threadStatistics : statistics.threads) {
+        executedTaskCount += threadStatistics.executedTaskCount;
+        queueHighWaterMark = std::max(queueHighWaterMark, threadStatistics.queueHighWaterMark);
+        busyNanoseconds += threadStatistics.busyDuration.count();
+    }
+    uint64_t latencyCount = 0;
+    for (auto bucket : statistics.latencyHistogram) {
+        latencyCount += bucket;
+    }
+    CHECK(executedTaskCount == TestCount + threadPool.get_thread_count());
+    CHECK(queueHighWaterMark);
+    if (createInfo.timingStatisticsEnabled) {
+        CHECK(latencyCount == TestCount + threadPool.get_thread_count());
+        CHECK(busyNanoseconds > 0);
+    } else {
+        CHECK(latencyCount == 0);
+        CHECK(busyNanoseconds == 0);
+    }
+}
+
+/**
+Validates that ThreadPool::resize() changes the number of threads processing tasks
+*/
+TEST_CASE("ThreadPool::resize()", "[ThreadPool]")
+{
+    ThreadPool::CreateInfo createInfo { };
+    createInfo.threadCount = 2;
+    createInfo.maxThreadCount = 4;
+    ThreadPool threadPool(createInfo);
+    CHECK(threadPool.get_thread_count() == 2);
+    CHECK(threadPool.get_max_thread_count() == 4);
+    std::vector<std::string> taskResults(TestCount);
+    for (size_t i = 0; i < TestCount; ++i) {
+        threadPool.push_detached([i, &taskResults]() { taskResults[i] = make_word(i); });
+        if (i == TestCount / 4) {
+            threadPool.resize(4);
+            CHECK(threadPool.get_thread_count() == 4);
+        } else if (i == TestCount / 2) {
+            threadPool.resize(1);
+            CHECK(threadPool.get_thread_count() == 1);
+        } else if (i == TestCount * 3 / 4) {
+            threadPool.resize(8);
+            CHECK(threadPool.get_thread_count() == 4);
+        }
+    }
+    threadPool.push([&]() { threadPool.resize(0); }).get();
+    CHECK(threadPool.get_thread_count() == 1);
+    threadPool.wait();
+    for (size_t i = 0; i < taskResults.size(); ++i) {
+        if (taskResults[i] != make_word(i)) {
+            FAIL();
+        }
+    }
+}
+
+/**
+Validates that tasks calling ThreadPool::resize() while their ThreadPool is being destroyed don't start threads that aren't joined
+*/
+TEST_CASE("ThreadPool::~ThreadPool() (resize during destruction)", "[ThreadPool]")
+{
+    for (size_t i = 0; i < TestCount; ++i) {
+        ThreadPool::CreateInfo createInfo { };
+        createInfo.threadCount = 1;
+        createInfo.maxThreadCount = 4;
+        createInfo.growLatency = Microseconds<> { 1 };
+        auto upThreadPool = std::make_unique<ThreadPool>(createInfo);
+        auto pThreadPool = upThreadPool.get();
+        for (size_t j = 0; j < TestCount; ++j) {
+            pThreadPool->push_detached(
+                [pThreadPool, j]()
+                {
+                    std::this_thread::sleep_for(Microseconds<> { 10 });
+                    pThreadPool->resize(j % 2 ? 4 : 1);
+                }
+            );
+        }
+        upThreadPool.reset();
+    }
+}
+
+/**
+Validates that an elastic ThreadPool starts threads when tasks wait and stops them when they're idle
+*/
+TEST_CASE("ThreadPool::CreateInfo (elastic)", "[ThreadPool]")
+{
+    ThreadPool::CreateInfo createInfo { };
+    createInfo.threadCount = 1;
+    createInfo.maxThreadCount = 4;
+    createInfo.growLatency = Milliseconds<> { 1 };
+    createInfo.retireTimeout = Milliseconds<> { 20 };
+    ThreadPool threadPool(createInfo);
+    std::promise<void> queued;
+    std::promise<void> release;
+    auto queuedFuture = queued.get_future().share();
+    auto releaseFuture = release.get_future().share();
+    auto blockerFuture = threadPool.push(
+        [queuedFuture, &createInfo]()
+        {
+            // NOTE : The tasks queued behind this task must wait longer than
+            //  growLatency, elapsed time is the only thing that triggers growth.
+            queuedFuture.wait();
+            Timer timer;
+            while (timer.total<Milliseconds<>>() <= createInfo.growLatency.count() * 2) {
+                std::this_thread::yield();
+            }
+        }
+    );
+    auto future = threadPool.push_batch(2, [releaseFuture](size_t) { releaseFuture.wait(); });
+    queued.set_value();
+    Timer timer;
+    while (threadPool.get_thread_count() == 1 && timer.total<Seconds<>>() < 5) {
+        std::this_thread::sleep_for(Milliseconds<> { 1 });
+    }
+    CHECK(threadPool.get_thread_count() > 1);
+    release.set_value();
+    blockerFuture.get();
+    future.get();
+    timer.reset();
+    while (threadPool.get_thread_count() > 1 && timer.total<Seconds<>>() < 5) {
+        std::this_thread::sleep_for(Milliseconds<> { 10 });
+    }
+    CHECK(threadPool.get_thread_count() == 1);
+}
+
+/**
+Validates that a ThreadPool without threads processes tasks on waiting threads in Priority order
+*/
+TEST_CASE("ThreadPool::CreateInfo (Execution::Deferred)", "[ThreadPool]")
+{
+    ThreadPool threadPool(0);
+    CHECK(threadPool.get_execution() == ThreadPool::Execution::Deferred);
+    CHECK(threadPool.get_thread_count() == 0);
+    CHECK(threadPool.get_max_thread_count() == 0);
+    std::vector<int> order;
+    std::vector<std::thread::id> threadIds;
+    auto record = [&](int value) { order.push_back(value); threadIds.push_back(std::this_thread::get_id()); };
+    threadPool.push_detached([&]() { record(0); });
+    auto future = threadPool.push([&]() { record(1); return 2; });
+    threadPool.push_detached([&]() { record(3); }, { ThreadPool::Priority::High });
+    CHECK(order.empty());
+    CHECK(threadPool.get_task_count() == 3);
+    threadPool.resize(4);
+    CHECK(threadPool.get_thread_count() == 0);
+    CHECK(future.get() == 2);
+    threadPool.wait();
+    CHECK(order == std::vector<int> { 3, 0, 1 });
+    CHECK(std::all_of(threadIds.begin(), threadIds.end(), [](std::thread::id threadId) { return threadId == std::this_thread::get_id(); }));
+    std::atomic_int count { 0 };
+    threadPool.push_batch(TestCount, [&](size_t) { ++count; });
+    threadPool.wait();
+    CHECK(count == TestCount);
+}
+
+/**
+Validates that a ThreadPool using Execution::Immediate processes tasks before push() returns
+*/
+TEST_CASE("ThreadPool::CreateInfo (Execution::Immediate)", "[ThreadPool]")
+{
+    ThreadPool::CreateInfo createInfo { };
+    createInfo.execution = ThreadPool::Execution::Immediate;
+    ThreadPool threadPool(createInfo);
+    CHECK(threadPool.get_thread_count() == 0);
+    std::vector<int> order;
+    auto future = threadPool.push(
+        [&]()
+        {
+            order.push_back(0);
+            threadPool.push_detached([&]() { order.push_back(1); });
+            order.push_back(2);
+            return std::this_thread::get_id();
+        }
+    );
+    CHECK(future.is_ready());
+    CHECK(future.get() == std::this_thread::get_id());
+    CHECK(order == std::vector<int> { 0, 1, 2 });
+    CHECK(threadPool.push_batch(TestCount, [&](size_t i) { order.push_back((int)i); }).is_ready());
+    CHECK(order.size() == 3 + TestCount);
+    CHECK(threadPool.get_task_count() == 0);
+    threadPool.wait();
+    CHECK(threadPool.get_statistics().otherThreads.executedTaskCount == 2 + TestCount);
+}
+
+/**
+Validates that ThreadPool::push_after() queues tasks after their delay and that timers can be cancelled
+*/
+TEST_CASE("ThreadPool::push_after()", "[ThreadPool]")
+{
+    std::atomic_int count { 0 };
+    std::promise<void> counted;
+    std::promise<double> elapsed;
+    ThreadPool threadPool(2);
+    Timer timer;
+    threadPool.push_after(Milliseconds<> { 20 }, [&]() { elapsed.set_value(timer.total<Milliseconds<>>()); });
+    auto cancelledTimerId = threadPool.push_after(Milliseconds<> { 10 }, [&]() { ++count; });
+    for (int i = 0; i < TestCount; ++i) {
+        threadPool.push_after(
+            Milliseconds<> { (double)(i % 16) },
+            [&]()
+            {
+                if (++count == TestCount) {
+                    counted.set_value();
+                }
+            },
+            { ThreadPool::Priority::High }
+        );
+    }
+    CHECK(threadPool.cancel_timer(cancelledTimerId));
+    CHECK_FALSE(threadPool.cancel_timer(cancelledTimerId));
+    CHECK(elapsed.get_future().get() >= 20);
+    counted.get_future().wait();
+    threadPool.wait();
+    CHECK(threadPool.get_timer_count() == 0);
+    CHECK(count == TestCount);
+}
+
+/**
+Validates that ThreadPool::push_every() queues tasks repeatedly until cancelled
+*/
+TEST_CASE("ThreadPool::push_every()", "[ThreadPool]")
+{
+    std::atomic_int count { 0 };
+    std::promise<void> counted;
+    std::promise<void> drained;
+    std::promise<void> expired;
+    ThreadPool threadPool(2);
+    auto timerId = threadPool.push_every(
+        Milliseconds<> { 2 },
+        [&]()
+        {
+            if (++count == 4) {
+                counted.set_value();
+            }
+        }
+    );
+    counted.get_future().wait();
+    CHECK(threadPool.cancel_timer(timerId));
+    CHECK(threadPool.get_timer_count() == 0);
+    // NOTE : Timers expire in order and their tasks are queued in order, so once
+    //  a later timer's task has run, tasks queued by the cancelled timer before it
+    //  was cancelled have been queued.  Once a timer due after several of the
+    //  cancelled timer's periods has run, the cancelled timer would have run.
+    threadPool.push_after(Milliseconds<> { 0 }, [&]() { drained.set_value(); });
+    drained.get_future().wait();
+    threadPool.wait();
+    auto cancelledCount = count.load();
+    threadPool.push_after(Milliseconds<> { 8 }, [&]() { expired.set_value(); });
+    expired.get_future().wait();
+    threadPool.wait();
+    CHECK(count == cancelledCount);
+    threadPool.push_every(Milliseconds<> { 1 }, [&]() { ++count; });
+}
+
+/**
+Validates that tasks are dropped when their PushInfo::cancellationToken is cancelled and that running tasks can poll it
+*/
+TEST_CASE("ThreadPool::PushInfo::cancellationToken", "[ThreadPool]")
+{
+    ThreadPool threadPool(1);
+    std::promise<void> pollerStarted;
+    CancellationSource pollerCancellationSource;
+    auto pollerFuture = threadPool.push(
+        [&]()
+        {
+            pollerStarted.set_value();
+            auto cancellationToken = ThreadPool::get_current_cancellation_token();
+            while (!cancellationToken.is_cancelled()) {
+                std::this_thread::yield();
+            }
+            return cancellationToken.can_be_cancelled();
+        },
+        { ThreadPool::Priority::Normal, ThreadPool::AnyNode, pollerCancellationSource.get_token() }
+    );
+    pollerStarted.get_future().wait();
+    std::atomic_int count { 0 };
+    CancellationSource cancellationSource;
+    ThreadPool::PushInfo pushInfo { };
+    pushInfo.cancellationToken = cancellationSource.get_token();
+    auto future = threadPool.push([&]() { ++count; }, pushInfo);
+    auto batchFuture = threadPool.push_batch(TestCount, [&](size_t) { ++count; }, pushInfo);
+    threadPool.push_detached([&]() { ++count; });
+    cancellationSource.cancel();
+    pollerCancellationSource.cancel();
+    CHECK(pollerFuture.get());
+    CHECK_THROWS_AS(future.get(), std::future_error);
+    CHECK_THROWS_AS(batchFuture.get(), std::future_error);
+    threadPool.wait();
+    CHECK(count == 1);
+    auto statistics = threadPool.get_statistics();
+    CHECK(statistics.threads[0].cancelledTaskCount + statistics.otherThreads.cancelledTaskCount == 1 + TestCount);
+    CHECK_FALSE(ThreadPool::get_current_cancellation_token().can_be_cancelled());
+}
+
 /**
 Validates that ThreadPool completes pending tasks on destruction
 */
 TEST_CASE("ThreadPool::~ThreadPool()", "[ThreadPool]")
 {
     std::vector<std::string> taskResults(TestCount);
-    std::vector<std::future<void>> futures(TestCount);
+    std::vector<Future<void>> futures(TestCount);
     {
         ThreadPool threadPool;
-        threadPool.push([]() { std::this_thread::sleep_for(Seconds<> { 0.25 }); });
+        std::promise<void> release;
+        block_threads(threadPool, release.get_future().share());
         for (size_t i = 0; i < TestCount; ++i) {
             auto future = threadPool.push(
                 [i, &taskResults]()
@@ -125,6 +767,8 @@ TEST_CASE("ThreadPool::~ThreadPool()", "[ThreadPool]")
             );
             futures[i] = std::move(future);
         }
+        CHECK(threadPool.get_task_count() == TestCount);
+        release.set_value();
     }
     SECTION("future.wait()")
     {
@@ -0,0 +1,114 @@
+/*
+==========================================
+  Copyright (c) 2020 Dynamic_Static
+    Patrick Purcell
+      Licensed under the MIT license
+    http://opensource.org/licenses/MIT
+==========================================
+*/
+
+#include "dynamic_static/core/timer-wheel.hpp"
+
+#include "catch2/catch.hpp"
+
+#include <iterator>
+#include <random>
+#include <vector>
+
+namespace dst {
+namespace tests {
+
+/**
+Validates that TimerWheel<> entries expire at their tick across every level
+*/
+TEST_CASE("TimerWheel<>::advance()", "[TimerWheel]")
+{
+    TimerWheel<int> timerWheel(5);
+    const uint64_t Offsets[] { 0, 1, 63, 64, 65, 4095, 4096, 4097, 262143, 262144, 300000, 16777215, 16777216, 40000000 };
+    std::vector<TimerWheel<int>::Id> ids;
+    for (auto offset : Offsets) {
+        ids.push_back(timerWheel.insert(5 + offset, (int)offset));
+    }
+    CHECK(timerWheel.size() == std::size(Offsets));
+    std::vector<TimerWheel<int>::Id> expiredIds;
+    for (size_t i = 0; i < std::size(Offsets); ++i) {
+        auto tick = 5 + Offsets[i];
+        if (tick > 5) {
+            timerWheel.advance(tick - 1, expiredIds);
+            CHECK(expiredIds.empty());
+        }
+        timerWheel.advance(tick, expiredIds);
+        REQUIRE(expiredIds.size() == 1);
+        CHECK(expiredIds[0] == ids[i]);
+        CHECK(*timerWheel.get(expiredIds[0]) == (int)Offsets[i]);
+        CHECK(timerWheel.erase(expiredIds[0]));
+        expiredIds.clear();
+    }
+    CHECK(timerWheel.empty());
+    CHECK(timerWheel.get_next_tick() == TimerWheel<int>::InvalidTick);
+}
+
+/**
+Validates that TimerWheel<> entries can be erased and rescheduled
+*/
+TEST_CASE("TimerWheel<>::erase() and TimerWheel<>::reschedule()", "[TimerWheel]")
+{
+    TimerWheel<int> timerWheel;
+    auto id0 = timerWheel.insert(10, 0);
+    auto id1 = timerWheel.insert(100, 1);
+    auto id2 = timerWheel.insert(1000, 2);
+    CHECK(timerWheel.erase(id1));
+    CHECK_FALSE(timerWheel.erase(id1));
+    CHECK(timerWheel.get(id1) == nullptr);
+    CHECK(timerWheel.reschedule(id2, 20));
+    CHECK(timerWheel.get_tick(id2) == 20);
+    CHECK(timerWheel.get_next_tick() == 10);
+    std::vector<TimerWheel<int>::Id> expiredIds;
+    timerWheel.advance(10, expiredIds);
+    CHECK(expiredIds == std::vector<TimerWheel<int>::Id> { id0 });
+    CHECK(timerWheel.reschedule(id0, 15));
+    expiredIds.clear();
+    timerWheel.advance(2000, expiredIds);
+    CHECK(expiredIds == std::vector<TimerWheel<int>::Id> { id0, id2 });
+    auto id3 = timerWheel.insert(5, 3);
+    CHECK(id3 != id1);
+    expiredIds.clear();
+    timerWheel.advance(2001, expiredIds);
+    CHECK(expiredIds == std::vector<TimerWheel<int>::Id> { id3 });
+}
+
+/**
+Validates that TimerWheel<> expires randomly scheduled entries in tick order
+*/
+TEST_CASE("TimerWheel<> (random ticks)", "[TimerWheel]")
+{
+    std::mt19937_64 engine(7);
+    std::uniform_int_distribution<uint64_t> distribution(0, 20000000);
+    TimerWheel<uint64_t> timerWheel(12345);
+    for (int i = 0; i < 2048; ++i) {
+        auto tick = 12345 + distribution(engine);
+        timerWheel.insert(tick, tick);
+    }
+    std::vector<TimerWheel<uint64_t>::Id> expiredIds;
+    uint64_t tick = 12345;
+    uint64_t previousTick = 0;
+    size_t expiredCount = 0;
+    int errorCount = 0;
+    while (!timerWheel.empty()) {
+        tick += std::uniform_int_distribution<uint64_t>(1, 100000)(engine);
+        timerWheel.advance(tick, expiredIds);
+        for (auto id : expiredIds) {
+            auto expectedTick = *timerWheel.get(id);
+            errorCount += expectedTick > tick || expectedTick + 100000 <= tick || expectedTick < previousTick;
+            previousTick = expectedTick;
+            timerWheel.erase(id);
+        }
+        expiredCount += expiredIds.size();
+        expiredIds.clear();
+    }
+    CHECK(expiredCount == 2048);
+    CHECK(errorCount == 0);
+}
+
+} // namespace tests
+} // namespace dst